@@ -0,0 +1,72 @@
+#include "graphGen.h"
+
+using namespace graphGen;
+using namespace std;
+
+// 각 최단 경로 풀이가 간선을 살펴본 횟수를 V + E로 나눈 값(blow-up factor)을 출력
+
+using WGraph = BasicGraph<long long>;
+constexpr long long INF = LLONG_MAX / 4;
+
+vector<vector<pair<int, long long>>> make_adj(const WGraph& g, const bool directed) {
+    vector<vector<pair<int, long long>>> adj(g.V() + 1);
+    for(size_t i = 0; i < g.edge_list().size(); i++) {
+        const auto [a, b] = g.edge_list()[i];
+        adj[a].emplace_back(b, g.weight_list()[i]);
+        if(!directed) adj[b].emplace_back(a, g.weight_list()[i]);
+    }
+    return adj;
+}
+
+long long dijkstra(const vector<vector<pair<int, long long>>>& adj, const bool skip_stale) {
+    vector<long long> dist(adj.size(), INF);
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<>> pq;
+    long long scans = 0;
+    dist[1] = 0, pq.emplace(0, 1);
+    while(!pq.empty()) {
+        const auto [d, u] = pq.top(); pq.pop();
+        if(skip_stale && d > dist[u]) continue;
+        for(const auto& [w, c] : adj[u]) {
+            scans++;
+            if(dist[u] + c < dist[w]) dist[w] = dist[u] + c, pq.emplace(dist[w], w);
+        }
+    }
+    return scans;
+}
+
+long long spfa(const vector<vector<pair<int, long long>>>& adj) {
+    vector<long long> dist(adj.size(), INF);
+    vector<bool> in_queue(adj.size(), false);
+    deque<int> q{1};
+    long long scans = 0;
+    dist[1] = 0, in_queue[1] = true;
+    while(!q.empty()) {
+        const int u = q.front(); q.pop_front();
+        in_queue[u] = false;
+        for(const auto& [w, c] : adj[u]) {
+            scans++;
+            if(dist[u] + c < dist[w]) {
+                dist[w] = dist[u] + c;
+                if(!in_queue[w]) in_queue[w] = true, q.push_back(w);
+            }
+        }
+    }
+    return scans;
+}
+
+void report(const string& name, const WGraph& g, const bool directed) {
+    const auto adj = make_adj(g, directed);
+    const double size = g.V() + g.E();
+    cerr << setw(28) << left << name << " V=" << setw(8) << g.V() << " E=" << setw(8) << g.E() << fixed << setprecision(1)
+         << " dijkstra=" << setw(8) << dijkstra(adj, true) / size
+         << " dijkstra_no_check=" << setw(8) << dijkstra(adj, false) / size
+         << " spfa=" << spfa(adj) / size << '\n';
+}
+
+int main(int argc, char** argv) {
+    registerGen(argc, argv, 1);
+    report("random_regular 100000 4", WGraph::random_regular(100000, 4).fill_weights_uniform(1, 1'000'000'000), false);
+    report("anti_spfa_grid 10 x 10000", WGraph::anti_spfa_grid(10, 10000, 1'000'000'000, 10), false);
+    report("anti_spfa_grid 100 x 1000", WGraph::anti_spfa_grid(100, 1000, 1'000'000'000, 10), false);
+    report("anti_dijkstra_chain 100000", WGraph::anti_dijkstra_chain(100000), true);
+}
@@ -14,11 +14,136 @@ namespace graphGen {
 
 #define chk(b, msg) chk_(b, msg, __LINE__)
 
+    /**
+     * @brief a hash set of edges. <br>
+     * used by generators that have to reject duplicate edges in O(1).
+     */
+    class EdgeIndex {
+        std::unordered_set<unsigned long long> s;
+
+        static unsigned long long key(const int a, const int b) {
+            return static_cast<unsigned long long>(static_cast<unsigned>(a)) << 32 | static_cast<unsigned>(b);
+        }
+    public:
+        EdgeIndex() = default;
+
+        /**
+         * @param expected the expected number of edges, used to reserve buckets
+         */
+        explicit EdgeIndex(const size_t expected) { s.reserve(expected); }
+
+        /// @return whether the edge a -> b is in the index
+        [[nodiscard]] bool contains(const int a, const int b) const { return s.find(key(a, b)) != s.end(); }
+
+        /// @return whether the edge a -- b is in the index
+        [[nodiscard]] bool contains_undir(const int a, const int b) const { return contains(std::min(a, b), std::max(a, b)); }
+
+        /// @return false if the edge a -> b was already in the index
+        bool insert(const int a, const int b) { return s.insert(key(a, b)).second; }
+
+        /// @return false if the edge a -- b was already in the index
+        bool insert_undir(const int a, const int b) { return insert(std::min(a, b), std::max(a, b)); }
+
+        /// @return false if the edge a -> b was not in the index
+        bool erase(const int a, const int b) { return s.erase(key(a, b)) > 0; }
+
+        /// @return false if the edge a -- b was not in the index
+        bool erase_undir(const int a, const int b) { return erase(std::min(a, b), std::max(a, b)); }
+
+        [[nodiscard]] size_t size() const { return s.size(); }
+    };
+
+    /**
+     * @brief the orientation of a tournament packed into bits: row u has bit v - 1 set if u beats v (u -> v). <br>
+     * made by BasicGraph::tournament_matrix and BasicGraph::transitive_tournament_matrix.
+     */
+    class TournamentMatrix {
+        template <typename> friend class BasicGraph;
+
+        int n = 0;
+        size_t words = 0;
+        // bits[(u - 1) * words + w]: u의 행에서 w번째 64비트 묶음
+        std::vector<unsigned long long> bits;
+
+        explicit TournamentMatrix(const int n) : n(n), words((n + 63) / 64), bits(static_cast<size_t>(n) * words, 0) {}
+
+        [[nodiscard]] unsigned long long& word(const int u, const size_t w) { return bits[(u - 1) * words + w]; }
+        [[nodiscard]] unsigned long long word(const int u, const size_t w) const { return bits[(u - 1) * words + w]; }
+    public:
+        TournamentMatrix() = default;
+
+        [[nodiscard]] int size() const { return n; }
+
+        /// @return whether u beats v (the edge u -> v)
+        [[nodiscard]] bool beats(const int u, const int v) const { return word(u, (v - 1) >> 6) >> ((v - 1) & 63) & 1; }
+
+        /// reverses the edge between u and v (u != v)
+        void flip(const int u, const int v) {
+            word(u, (v - 1) >> 6) ^= 1ULL << ((v - 1) & 63);
+            word(v, (u - 1) >> 6) ^= 1ULL << ((u - 1) & 63);
+        }
+
+        /// @return the out-degree of u
+        [[nodiscard]] int out_degree(const int u) const {
+            int ret = 0;
+            for(size_t w = 0; w < words; w++) ret += std::popcount(word(u, w));
+            return ret;
+        }
+
+        /**
+         * @brief counts the cyclic triangles: C(n, 3) - sum C(out_degree(u), 2)
+         *
+         * Time complexity: O(n^2 / 64)
+         */
+        [[nodiscard]] long long three_cycle_count() const {
+            long long ret = 1LL * n * (n - 1) * (n - 2) / 6;
+            for(int u = 1; u <= n; u++) {
+                const long long d = out_degree(u);
+                ret -= d * (d - 1) / 2;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief prints n rows of n characters, where the v-th character of row u is '1' if u beats v
+         *
+         * Time complexity: O(n^2)
+         */
+        void print_rows() const {
+            std::string row(n, '0');
+            for(int u = 1; u <= n; u++) {
+                for(int v = 0; v < n; v++) row[v] = static_cast<char>('0' + (word(u, v >> 6) >> (v & 63) & 1));
+                println(row);
+            }
+        }
+
+        /**
+         * @brief prints the n(n-1)/2 edges "u v" (u beats v), visiting only the set bits
+         *
+         * Time complexity: O(n^2)
+         */
+        void print_edges() const {
+            for(int u = 1; u <= n; u++) for(size_t w = 0; w < words; w++)
+                for(unsigned long long x = word(u, w); x; x &= x - 1) println(u, static_cast<int>(w * 64 + std::countr_zero(x)) + 1);
+        }
+    };
+
+    template <typename Cap = long long> struct FlowNetwork;
+
     // nodes : 1 ~ V
-    class Graph {
+    // W : 간선마다 붙는 값(가중치)의 타입. void이면 가중치를 저장하지 않음
+    template <typename W = void> class BasicGraph {
+        template <typename> friend class BasicGraph;
+    public:
+        static constexpr bool weighted = !std::is_void_v<W>;
+        using weight_type = std::conditional_t<weighted, W, char>;
     protected:
+        struct NoWeights {};
+
         int v = 0;
         std::vector<std::pair<int, int>> edges;
+        // weighted이면 weights[i]가 edges[i]의 가중치
+        [[no_unique_address]] std::conditional_t<weighted, std::vector<weight_type>, NoWeights> weights;
         std::vector<int> group;
         std::vector<int> rank;
 
@@ -46,17 +171,324 @@ namespace graphGen {
                 rank[b] += rank[a] == rank[b];
             }
         }
+
+        /**
+         * @brief builds a graph that takes over an edge buffer. <br>
+         * the groups are computed in a single pass over the buffer,
+         * or skipped if the caller guarantees that the graph is connected.
+         *
+         * Time complexity: approx. O(n + E)
+         */
+        static BasicGraph from_edge_buffer(const int n, std::vector<std::pair<int, int>>&& buf, const bool connected = false) {
+            BasicGraph ret(n);
+            ret.edges = std::move(buf);
+            if constexpr(weighted) ret.weights.assign(ret.edges.size(), weight_type{});
+            if(connected) {
+                for(int i = 2; i <= n; i++) ret.group[i] = 1;
+                if(n > 1) ret.rank[1] = 1;
+            } else for(const auto& [a, b] : ret.edges) ret.merge_group(a, b);
+            return ret;
+        }
+
+        /**
+         * @brief the graph with the same nodes and the edges edges[ids[0]], edges[ids[1]], ... (and their weights)
+         *
+         * Time complexity: approx. O(V + ids.size())
+         */
+        [[nodiscard]] BasicGraph edge_subset(const std::vector<int>& ids, const bool connected) const {
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(ids.size());
+            for(const int id : ids) buf.push_back(edges[id]);
+            BasicGraph ret = from_edge_buffer(v, std::move(buf), connected);
+            if constexpr(weighted) for(size_t i = 0; i < ids.size(); i++) ret.weights[i] = weights[ids[i]];
+            return ret;
+        }
+
+        /**
+         * @brief builds a tree from a parent array. the root is the index whose parent is -1. <br>
+         * the nodes get random numbers, except that the root becomes root_label if it is not 0.
+         *
+         * Time complexity: O(n)
+         */
+        static BasicGraph from_parent_array(const std::vector<int>& par, const int root_label = 1) {
+            const int n = static_cast<int>(par.size());
+            int root = 0;
+            for(int i = 0; i < n; i++) if(par[i] == -1) root = i;
+            std::vector<int> label(n);
+            for(int i = 0; i < n; i++) label[i] = i + 1;
+            shuffle(label.begin(), label.end());
+            if(root_label) for(int i = 0; i < n; i++) if(label[i] == root_label) std::swap(label[i], label[root]);
+
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(n - 1);
+            for(int i = 0; i < n; i++) if(i != root) buf.emplace_back(label[par[i]], label[i]);
+            return from_edge_buffer(n, std::move(buf), true);
+        }
+
+        /// the undirected adjacency in CSR form: the neighbours of u are to[start[u] .. start[u+1]), reached by the edges id[...]
+        struct Csr {
+            std::vector<int> start, to, id;
+        };
+
+        /**
+         * @brief builds the undirected CSR view of this graph
+         *
+         * Time complexity: O(V + E)
+         */
+        [[nodiscard]] Csr csr() const {
+            const int m = static_cast<int>(edges.size());
+            Csr ret{std::vector<int>(v + 2, 0), std::vector<int>(2 * m), std::vector<int>(2 * m)};
+            auto& [start, to, id] = ret;
+            for(const auto& [a, b] : edges) start[a + 1]++, start[b + 1]++;
+            for(int i = 1; i <= v + 1; i++) start[i] += start[i - 1];
+            std::vector<int> pos(start.begin(), start.end() - 1);
+            for(int e = 0; e < m; e++) {
+                const auto [a, b] = edges[e];
+                to[pos[a]] = b, id[pos[a]++] = e;
+                to[pos[b]] = a, id[pos[b]++] = e;
+            }
+            return ret;
+        }
+
+        /**
+         * @brief Wilson's algorithm over a CSR view of base
+         * @return the indices (in base.edges) of the edges of a uniform spanning tree
+         */
+        static std::vector<int> spanning_tree_edge_ids(const BasicGraph& base) {
+            const int n = base.V();
+            chk(n >= 1, "the base graph must have at least one node");
+            const auto [start, to, id] = base.csr();
+
+            std::vector<bool> in_tree(n + 1, false);
+            std::vector<int> queue{1};
+            in_tree[1] = true;
+            for(size_t h = 0; h < queue.size(); h++)
+                for(int j = start[queue[h]]; j < start[queue[h] + 1]; j++)
+                    if(!in_tree[to[j]]) in_tree[to[j]] = true, queue.push_back(to[j]);
+            chk(static_cast<int>(queue.size()) == n, "the base graph must be connected");
+
+            // 루프가 지워진 랜덤 워크: nxt[u]는 u에서 마지막으로 나간 CSR 위치
+            std::fill(in_tree.begin(), in_tree.end(), false);
+            in_tree[rnd.next(n) + 1] = true;
+            std::vector<int> nxt(n + 1, -1), ret;
+            ret.reserve(n - 1);
+            for(int s = 1; s <= n; s++) {
+                for(int u = s; !in_tree[u]; u = to[nxt[u]])
+                    nxt[u] = start[u] + rnd.next(start[u + 1] - start[u]);
+                for(int u = s; !in_tree[u]; u = to[nxt[u]])
+                    in_tree[u] = true, ret.push_back(id[nxt[u]]);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief builds an ear decomposition on the nodes in label, with exactly m edges. <br>
+         * a cycle, then open ears (paths of new nodes between two distinct existing nodes),
+         * then chords. the result is 2-vertex-connected,
+         * or only 2-edge-connected if closed ears (cycles hanging from one node) are allowed.
+         *
+         * Time complexity: O(s + m) expected, where s = label.size()
+         */
+        static void ear_decomposition(const std::vector<int>& label, const long long m, const bool closed_ears,
+                                      std::vector<std::pair<int, int>>& buf, EdgeIndex& index) {
+            const int s = static_cast<int>(label.size());
+            if(s == 1) return;
+            chk(s >= 3 && s <= m && m <= 1LL * s * (s - 1) / 2, "cannot make a 2-connected block");
+            auto push = [&](const int a, const int b) { index.insert_undir(label[a], label[b]); buf.emplace_back(label[a], label[b]); };
+
+            // 새 노드를 쓰는 귀가 ears개, 그 귀들의 노드가 total개. 나머지 m - s - ears개는 현(chord)
+            const int ears = static_cast<int>(rnd.next(0LL, std::min<long long>(m - s, s - 3)));
+            const int total = ears ? rnd.next(ears, s - 3) : 0;
+            int cur = s - total;
+            for(int i = 0; i < cur; i++) push(i, (i + 1) % cur);
+            if(ears) for(const int len : distribute_natural_numbers(total, ears)) {
+                const int from = rnd.next(cur);
+                int to = rnd.next(cur);
+                if(closed_ears && len >= 2 && rnd.next(2)) to = from;
+                else while(to == from) to = rnd.next(cur);
+                push(from, cur);
+                for(int j = 1; j < len; j++) push(cur + j - 1, cur + j);
+                push(cur + len - 1, to);
+                cur += len;
+            }
+            for(long long r = s + ears; r < m; r++) {
+                int a, b;
+                do {
+                    a = rnd.next(s), b = rnd.next(s);
+                } while(a == b || index.contains_undir(label[a], label[b]));
+                push(a, b);
+            }
+        }
+
+        /// @return the most edges k blocks of at least three nodes and total nodes can have (one large block and k-1 triangles)
+        static long long max_block_edges(const int total, const int k) {
+            const long long big = total - 3LL * (k - 1);
+            return big * (big - 1) / 2 + 3LL * (k - 1);
+        }
+
+        /**
+         * @brief random sizes of k blocks of at least three nodes with total nodes, whose complete graphs have at least need edges. <br>
+         * the sizes are redrawn up to 64 times, then one large block and k-1 triangles are used in a random order.
+         * @pre need <= max_block_edges(total, k)
+         */
+        static std::vector<int> block_sizes(const int total, const int k, const long long need) {
+            for(int attempt = 0; attempt < 64; attempt++) {
+                std::vector<int> sizes = distribute_natural_numbers(total - 2 * k, k);
+                long long cap = 0;
+                for(int& sz : sizes) sz += 2, cap += 1LL * sz * (sz - 1) / 2;
+                if(cap >= need) return sizes;
+            }
+            std::vector<int> sizes(k, 3);
+            sizes[0] = total - 3 * (k - 1);
+            shuffle(sizes.begin(), sizes.end());
+            return sizes;
+        }
+
+        /**
+         * @brief splits the extra edges of blocks randomly, respecting the capacity of each block
+         * @return the edge count of each block
+         */
+        static std::vector<long long> split_block_edges(const std::vector<int>& sizes, long long extra) {
+            const int k = static_cast<int>(sizes.size());
+            std::vector<long long> cnt(k), cap(k);
+            std::vector<int> open;
+            for(int i = 0; i < k; i++) {
+                cnt[i] = sizes[i] >= 3 ? sizes[i] : 0;
+                cap[i] = 1LL * sizes[i] * (sizes[i] - 1) / 2 - cnt[i];
+                if(cap[i] > 0) open.push_back(i);
+            }
+            while(extra > 0) {
+                const int j = rnd.next(static_cast<int>(open.size()));
+                const long long add = std::min(cap[open[j]], std::max(1LL, extra / static_cast<long long>(open.size()) / 2));
+                cnt[open[j]] += add, cap[open[j]] -= add, extra -= add;
+                if(cap[open[j]] == 0) std::swap(open[j], open.back()), open.pop_back();
+            }
+            return cnt;
+        }
+
+        /**
+         * @brief the edges of a random stacked triangulation of nodes 1..n. <br>
+         * edges 0, 1 and the first edge of every later triple form a spanning tree.
+         *
+         * Time complexity: O(n)
+         */
+        static std::vector<std::pair<int, int>> stacked_triangulation_edges(const int n) {
+            chk(n >= 3, "a triangulation must have at least three nodes");
+            std::vector<std::pair<int, int>> buf{{1, 2}, {2, 3}, {1, 3}};
+            buf.reserve(3LL * n - 6);
+            std::vector<std::array<int, 3>> faces{{1, 2, 3}, {1, 2, 3}};
+            faces.reserve(2LL * n - 4);
+            // 임의의 면 안에 새 노드를 넣고 세 꼭짓점과 이음. 면 하나가 세 개로 나뉨
+            for(int x = 4; x <= n; x++) {
+                const int f = rnd.next(static_cast<int>(faces.size()));
+                const auto [a, b, c] = faces[f];
+                buf.emplace_back(a, x), buf.emplace_back(b, x), buf.emplace_back(c, x);
+                faces[f] = {a, b, x};
+                faces.push_back({b, c, x}), faces.push_back({a, c, x});
+            }
+            return buf;
+        }
+
+        /**
+         * @brief adds edges to an Eulerian graph until it has m edges, by replacing a random edge a - b with a - c - b. <br>
+         * every move keeps the degree parity (or the in/out balance) and the connectivity.
+         * index must contain the edges of buf and every other edge that must not be used.
+         *
+         * Time complexity: O(n + m) expected, if at most about half of the pairs are used
+         * @return false if no move was found in 64 * (n + m) draws in a row (there may be none), true otherwise
+         */
+        static bool grow_eulerian(const int n, const long long m, const bool directed,
+                                  std::vector<std::pair<int, int>>& buf, EdgeIndex& index) {
+            auto has = [&](const int a, const int b) { return directed ? index.contains(a, b) : index.contains_undir(a, b); };
+            auto add = [&](const int a, const int b) { return directed ? index.insert(a, b) : index.insert_undir(a, b); };
+            const long long max_fails = 64 * (n + m);
+            long long fails = 0;
+            while(static_cast<long long>(buf.size()) < m) {
+                const int j = rnd.next(static_cast<int>(buf.size()));
+                const auto [a, b] = buf[j];
+                const int c = rnd.next(n) + 1;
+                if(c == a || c == b || has(a, c) || has(c, b)) {
+                    if(++fails > max_fails) return false;
+                    continue;
+                }
+                fails = 0;
+                if(directed) index.erase(a, b);
+                else index.erase_undir(a, b);
+                add(a, c), add(c, b);
+                buf[j] = {a, c}, buf.emplace_back(c, b);
+            }
+            return true;
+        }
+
+        /**
+         * @brief the number of failures before the first success of independent trials with success probability p,
+         * capped at limit (Batagelj-Brandes geometric skipping)
+         *
+         * Time complexity: O(1)
+         * @param log_q std::log1p(-p). log1p keeps it negative for tiny p, where log(1 - p) rounds to 0.
+         * @param limit the value returned when the skip reaches past the end (or cannot be represented)
+         */
+        static long long geometric_skip(const double log_q, const long long limit) {
+            const double s = std::floor(std::log1p(-rnd.next()) / log_q);
+            // p = 0, 0 / 0, 무한대 또는 limit 이상이면 끝을 넘은 것으로 봄
+            if(!(s < static_cast<double>(limit))) return limit;
+            return static_cast<long long>(s);
+        }
+
+        /**
+         * @brief samples k distinct integers from [0, N) with Floyd's algorithm
+         *
+         * Time complexity: O(k) expected
+         */
+        static std::vector<long long> sample_distinct(const long long k, const long long N) {
+            chk(0 <= k && k <= N, "cannot sample more values than the range has");
+            std::unordered_set<long long> seen;
+            seen.reserve(k);
+            std::vector<long long> ret;
+            ret.reserve(k);
+            for(long long j = N - k; j < N; j++) {
+                const long long t = rnd.next(j + 1);
+                if(seen.insert(t).second) ret.push_back(t);
+                else seen.insert(j), ret.push_back(j);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief the idx-th pair (a, b) with 0 <= a < b, in the order (0, 1), (0, 2), (1, 2), (0, 3), ...
+         *
+         * Time complexity: O(1)
+         */
+        static std::pair<int, int> pair_from_index(const long long idx) {
+            long long b = static_cast<long long>((1.0 + std::sqrt(1.0 + 8.0 * static_cast<double>(idx))) / 2.0);
+            while(b * (b - 1) / 2 > idx) b--;
+            while((b + 1) * b / 2 <= idx) b++;
+            return {static_cast<int>(idx - b * (b - 1) / 2), static_cast<int>(b)};
+        }
+
+        /**
+         * @brief transposes a 64 x 64 bit matrix in place: bit c of a[r] <-> bit r of a[c]
+         *
+         * Time complexity: O(64 * 6)
+         */
+        static void transpose64(unsigned long long a[64]) {
+            unsigned long long m = 0x00000000FFFFFFFFULL;
+            for(int j = 32; j; j >>= 1, m ^= m << j) for(int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+                const unsigned long long t = ((a[k] >> j) ^ a[k | j]) & m;
+                a[k] ^= t << j, a[k | j] ^= t;
+            }
+        }
     public:
         /**
          * @brief creates a placeholder object
          */
-        Graph() = default;
+        BasicGraph() = default;
 
         /**
          * @brief creates a new graph consisting of V nodes and zero edges
          * @param V the number of nodes
          */
-        explicit Graph(int V) : v(V), group(V+1), rank(V+1, 0) {
+        explicit BasicGraph(int V) : v(V), group(V+1), rank(V+1, 0) {
             for(int i = 1; i <= V; i++) group[i] = i;
         }
 
@@ -73,6 +505,25 @@ namespace graphGen {
         void add_edge(int a, int b) {
             chk(1 <= a && a <= v && 1 <= b && b <= v, "not a valid node");
             edges.emplace_back(a, b);
+            if constexpr(weighted) weights.emplace_back();
+            merge_group(a, b);
+        }
+
+        /**
+         * @brief adds the edge a -> b with weight w. <br>
+         * only available if W is not void.
+         *
+         * Time complexity: approx. O(1)
+         * @param a the starting vertex
+         * @param b the ending vertex
+         * @param w the weight of the edge
+         * @pre 1 <= a <= V
+         * @pre 1 <= b <= V
+         */
+        void add_edge(int a, int b, const weight_type& w) requires weighted {
+            chk(1 <= a && a <= v && 1 <= b && b <= v, "not a valid node");
+            edges.emplace_back(a, b);
+            weights.push_back(w);
             merge_group(a, b);
         }
 
@@ -159,6 +610,66 @@ namespace graphGen {
          */
         [[nodiscard]] std::vector<std::pair<int, int>> edge_list_copy() const { return edges; }
 
+        /**
+         * @brief the weights of the edges. weight_list()[i] is the weight of edge_list()[i]. <br>
+         * only available if W is not void.
+         *
+         * Time complexity: O(1)
+         * @return const std::vector<W>& containing the weights
+         */
+        [[nodiscard]] const std::vector<weight_type>& weight_list() const requires weighted { return weights; }
+
+        /**
+         * @brief the copy of this graph with another weight type. <br>
+         * the weights are converted if both types are not void, otherwise they are value-initialized.
+         *
+         * Time complexity: O(V + E)
+         * @return the converted graph
+         */
+        template <typename T> [[nodiscard]] BasicGraph<T> with_weight_type() const {
+            BasicGraph<T> ret;
+            ret.v = v, ret.edges = edges, ret.group = group, ret.rank = rank;
+            if constexpr(BasicGraph<T>::weighted) {
+                if constexpr(weighted) ret.weights.assign(weights.begin(), weights.end());
+                else ret.weights.assign(edges.size(), typename BasicGraph<T>::weight_type{});
+            }
+            return ret;
+        }
+
+        /**
+         * @brief sets every weight to a uniformly random value in [lo, hi]
+         *
+         * Time complexity: O(E)
+         * @return the reference of this graph
+         */
+        BasicGraph& fill_weights_uniform(const weight_type lo, const weight_type hi) requires weighted {
+            for(auto& w : weights) w = static_cast<weight_type>(rnd.next(lo, hi));
+            return *this;
+        }
+
+        /**
+         * @brief sets every weight to rnd.wnext(lo, hi, type). <br>
+         * positive type skews the weights towards hi, negative type towards lo.
+         *
+         * Time complexity: O(E * |type|)
+         * @return the reference of this graph
+         */
+        BasicGraph& fill_weights_wnext(const weight_type lo, const weight_type hi, const int type) requires weighted {
+            for(auto& w : weights) w = static_cast<weight_type>(rnd.wnext(lo, hi, type));
+            return *this;
+        }
+
+        /**
+         * @brief sets the weights to E distinct random values in [lo, hi]
+         *
+         * Time complexity: O(E) expected
+         * @return the reference of this graph
+         */
+        BasicGraph& fill_weights_distinct(const weight_type lo, const weight_type hi) requires weighted {
+            weights = rnd.distinct(static_cast<int>(edges.size()), lo, hi);
+            return *this;
+        }
+
         /**
          * @brief finds the group number of a vertex <br>
          * 'group' is unique numbers for each connected component
@@ -191,7 +702,15 @@ namespace graphGen {
          * Time complexity: O(E)
          * @return the reference of this graph
          */
-        Graph& shuffle_edge_list() { shuffle(edges.begin(), edges.end()); return *this; }
+        BasicGraph& shuffle_edge_list() {
+            if constexpr(!weighted) shuffle(edges.begin(), edges.end());
+            // testlib의 shuffle과 같은 순서로 간선과 가중치를 함께 섞음
+            else for(int i = 1; i < static_cast<int>(edges.size()); i++) {
+                const int j = rnd.next(i + 1);
+                std::swap(edges[i], edges[j]), std::swap(weights[i], weights[j]);
+            }
+            return *this;
+        }
 
         /**
          * @brief shuffles the order of edges and the order of nodes in the edges
@@ -199,7 +718,7 @@ namespace graphGen {
          * Time complexity: O(E)
          * @return the reference of this graph
          */
-        Graph& shuffle_edge_list_undir() {
+        BasicGraph& shuffle_edge_list_undir() {
             for(auto &[a, b] : edges) if(rnd.next(2)) std::swap(a, b);
             return shuffle_edge_list();
         }
@@ -287,15 +806,17 @@ namespace graphGen {
          * @param arr arr[prev_node_number] = next_node_number
          * @return the shuffled graph
          */
-        [[nodiscard]] Graph nodes_shuffled(const std::vector<int>& arr) const {
+        [[nodiscard]] BasicGraph nodes_shuffled(const std::vector<int>& arr) const {
             chk(arr.size() == v + 1, "size of arr at nodes_shuffled(arr) must be n+1");
             std::vector<bool> check(v + 1, false);
             for(int i = 1; i <= v; i++) check[arr[i]] = true;
             for(int i = 1; i <= v; i++) chk(arr[i], "arr should be a bijective function.");
 
-            Graph ret(v);
+            BasicGraph ret(v);
+            ret.edges.reserve(edges.size());
             for(const auto& [u, u2] : edges)
                 ret.add_edge(arr[u], arr[u2]);
+            if constexpr(weighted) ret.weights = weights;
             return ret;
         }
 
@@ -306,7 +827,7 @@ namespace graphGen {
          * Time complexity: O(V + E)
          * @return the shuffled graph
          */
-        [[nodiscard]] Graph nodes_shuffled() const {
+        [[nodiscard]] BasicGraph nodes_shuffled() const {
             std::vector<int> arr(v);
             for(int i = 0; i < v; i++) arr[i] = i+1;
             shuffle(arr.begin(), arr.end());
@@ -321,7 +842,7 @@ namespace graphGen {
          * @param arr arr[prev_node_number] = next_node_number
          * @return this graph
          */
-        Graph& shuffle_nodes(const std::vector<int>& arr) {
+        BasicGraph& shuffle_nodes(const std::vector<int>& arr) {
             *this = this->nodes_shuffled(arr);
             return *this;
         }
@@ -332,22 +853,69 @@ namespace graphGen {
          * Time complexity: O(V + E)
          * @return this graph
          */
-        Graph& shuffle_nodes() {
+        BasicGraph& shuffle_nodes() {
             *this = this->nodes_shuffled();
             return *this;
         }
 
-        [[nodiscard]] Graph edges_shuffled() const { Graph g = *this; g.shuffle_edge_list(); return g; }
-        [[nodiscard]] Graph edges_shuffled_undir() const { Graph g = *this; g.shuffle_edge_list_undir(); return g; }
+        [[nodiscard]] BasicGraph edges_shuffled() const { BasicGraph g = *this; g.shuffle_edge_list(); return g; }
+        [[nodiscard]] BasicGraph edges_shuffled_undir() const { BasicGraph g = *this; g.shuffle_edge_list_undir(); return g; }
 
-        Graph& shuffle_all() { return shuffle_nodes(), shuffle_edge_list(); }
-        Graph& shuffle_all_undir() { return shuffle_nodes(), shuffle_edge_list_undir(); }
-        [[nodiscard]] Graph all_shuffled() const { Graph g = *this; g.shuffle_all(); return g; }
-        [[nodiscard]] Graph all_shuffled_undir() const { Graph g = *this; g.shuffle_all_undir(); return g; }
+        BasicGraph& shuffle_all() { return shuffle_nodes(), shuffle_edge_list(); }
+        BasicGraph& shuffle_all_undir() { return shuffle_nodes(), shuffle_edge_list_undir(); }
+        [[nodiscard]] BasicGraph all_shuffled() const { BasicGraph g = *this; g.shuffle_all(); return g; }
+        [[nodiscard]] BasicGraph all_shuffled_undir() const { BasicGraph g = *this; g.shuffle_all_undir(); return g; }
 
         bool is_tree() { return static_cast<long long>(edges.size()) == v - 1 &&
             static_cast<long long>(connected_components().size()) == 1; }
 
+        /**
+         * @brief counts the bridges and the cut vertices of this undirected graph <br>
+         * uses an iterative lowlink DFS, so deep graphs do not overflow the stack.
+         * parallel edges are handled by skipping only the edge used to enter a node.
+         *
+         * Time complexity: O(V + E)
+         * @return {the number of bridges, the number of cut vertices}
+         */
+        [[nodiscard]] std::pair<int, int> bridge_and_cut_vertex_count() const {
+            const auto [start, to, id] = csr();
+
+            std::vector<int> tin(v + 1, 0), low(v + 1, 0), it(start.begin(), start.end() - 1), in_edge(v + 1, -1), stack;
+            std::vector<bool> cut(v + 1, false);
+            int timer = 0, bridges = 0;
+            for(int r = 1; r <= v; r++) {
+                if(tin[r]) continue;
+                int root_children = 0;
+                tin[r] = low[r] = ++timer;
+                stack.push_back(r);
+                while(!stack.empty()) {
+                    const int u = stack.back();
+                    if(it[u] < start[u + 1]) {
+                        const int j = it[u]++, w = to[j];
+                        if(id[j] == in_edge[u]) continue;
+                        if(tin[w]) low[u] = std::min(low[u], tin[w]);
+                        else in_edge[w] = id[j], tin[w] = low[w] = ++timer, stack.push_back(w);
+                        continue;
+                    }
+                    stack.pop_back();
+                    if(stack.empty()) break;
+                    const int p = stack.back();
+                    low[p] = std::min(low[p], low[u]);
+                    if(low[u] > tin[p]) bridges++;
+                    if(p == r) root_children++;
+                    else if(low[u] >= tin[p]) cut[p] = true;
+                }
+                if(root_children >= 2) cut[r] = true;
+            }
+            return {bridges, static_cast<int>(std::count(cut.begin(), cut.end(), true))};
+        }
+
+        /// @return the number of bridges of this undirected graph. see bridge_and_cut_vertex_count()
+        [[nodiscard]] int bridge_count() const { return bridge_and_cut_vertex_count().first; }
+
+        /// @return the number of cut vertices of this undirected graph. see bridge_and_cut_vertex_count()
+        [[nodiscard]] int cut_vertex_count() const { return bridge_and_cut_vertex_count().second; }
+
         /**
          * default elongation value. <br>
          * used in Graph::tree, Graph::halin_graph, etc.
@@ -362,9 +930,9 @@ namespace graphGen {
          * @param elongation the larger 'elongation' makes the generated tree longer. can be negative.
          * @return the generated tree
          */
-        static Graph tree(const int n, const int elongation) {
+        static BasicGraph tree(const int n, const int elongation) {
             if(elongation == DEFAULT_ELONGATION) return tree(n);
-            Graph ret(n);
+            BasicGraph ret(n);
             std::vector<int> p(n, 0);
             for(int i = 0; i <= n - 1; i++) if (i > 0) p[i] = rnd.wnext(i, elongation);
             std::vector<int> perm(n, 0); for(int i = 0; i <= n - 1; i++) perm[i] = i;
@@ -380,8 +948,8 @@ namespace graphGen {
          * @param n the node count
          * @return the generated tree
          */
-        static Graph tree(const int n) {
-            Graph ret(n);
+        static BasicGraph tree(const int n) {
+            BasicGraph ret(n);
             for(int i = 0; i < n-1; i++) {
                 int u, v;
                 do {
@@ -401,10 +969,10 @@ namespace graphGen {
          * @param elongation the larger 'elongation' makes the base tree longer. can be negative. not required.
          * @return the generated halin graph.
          */
-        static Graph halin_graph(const int n, const int elongation = DEFAULT_ELONGATION) {
+        static BasicGraph halin_graph(const int n, const int elongation = DEFAULT_ELONGATION) {
             chk(n >= 4, "a halin graph must have at least four nodes");
 
-            Graph tr = tree(n, elongation);
+            BasicGraph tr = tree(n, elongation);
             std::vector<std::vector<int>> adj(n + 1);
             for(const auto& [u, v] : tr.edge_list()) adj[u].push_back(v), adj[v].push_back(u);
             int root = 0;
@@ -447,7 +1015,7 @@ namespace graphGen {
             };
             f3(root);
 
-            Graph ret(n);
+            BasicGraph ret(n);
             for(int i = 1; i <= n; i++) for(int j : child[i]) ret.add_edge(i, j);
             int lsz = static_cast<int>(leaves.size());
             for(int i = 0; i < lsz - 1; i++) ret.add_edge(leaves[i], leaves[i + 1]);
@@ -455,9 +1023,9 @@ namespace graphGen {
             return ret;
         }
 
-        static Graph tree_without_degree_of_2(const int n, const int elongation = DEFAULT_ELONGATION) {
+        static BasicGraph tree_without_degree_of_2(const int n, const int elongation = DEFAULT_ELONGATION) {
             chk(n >= 4, "tree_without_degree_of_2 must have at least four nodes");
-            Graph tr = tree(n, elongation);
+            BasicGraph tr = tree(n, elongation);
             std::vector<std::vector<int>> adj(n + 1);
             for(const auto& [u, v] : tr.edge_list()) adj[u].push_back(v), adj[v].push_back(u);
             int root = 0;
@@ -483,7 +1051,7 @@ namespace graphGen {
                 }
             };
             f2(root, -1);
-            Graph ret(n);
+            BasicGraph ret(n);
             for(int i = 1; i <= n; i++) for(int j : child[i]) ret.add_edge(i, j);
             return ret;
         }
@@ -512,15 +1080,15 @@ namespace graphGen {
         /// @param tree_n : 사이클을 압축한 트리의 총 노드 수
         /// @param cycle_cnt : 사이클 수
         /// @param elongation : 트리의 elongation
-        static Graph cactus(const int n, const int tree_n, const int cycle_cnt, const int elongation = DEFAULT_ELONGATION) {
+        static BasicGraph cactus(const int n, const int tree_n, const int cycle_cnt, const int elongation = DEFAULT_ELONGATION) {
             chk(cycle_cnt <= tree_n, "cycle_cnt cannot be greater than tree_n.");
             chk(cycle_cnt <= n - tree_n, "cannot make cycles, cycle_cnt is too large.");
             chk(cycle_cnt || n == tree_n, "n must be equal to tree_n if cycle_cnt is 0.");
 
             if(!cycle_cnt) return tree(n, elongation);
 
-            Graph tr = tree(tree_n, elongation);
-            Graph ret = Graph(n);
+            BasicGraph tr = tree(tree_n, elongation);
+            BasicGraph ret = BasicGraph(n);
 
             std::set<int> cycleNodes;
             while(cycleNodes.size() < cycle_cnt) cycleNodes.insert(rnd.next(tree_n) + 1);
@@ -544,11 +1112,11 @@ namespace graphGen {
             return ret;
         }
 
-        static Graph connected_graph(const int n, const int m, const int elongation = DEFAULT_ELONGATION) {
+        static BasicGraph connected_graph(const int n, const int m, const int elongation = DEFAULT_ELONGATION) {
             chk(n >= 1, "a graph must have at least one node");
             chk(m >= n - 1, "edge count is too small to make a connected graph");
             chk(m <= n * (n - 1) / 2, "edge count is too large");
-            Graph ret;
+            BasicGraph ret;
             if(elongation == DEFAULT_ELONGATION) ret = tree(n);
             else ret = tree(n, elongation);
             for(int i=n-1; i<m; i++) {
@@ -562,10 +1130,10 @@ namespace graphGen {
             return ret;
         }
 
-        static Graph rand_graph(const int n, const int m) {
+        static BasicGraph rand_graph(const int n, const int m) {
             chk(n >= 1, "a graph must have at least one node");
             chk(m <= n * (n - 1) / 2, "edge count is too large");
-            Graph ret(n);
+            BasicGraph ret(n);
             for(int r = 0; r < m; r++) {
                 int u, v;
                 do {
@@ -577,89 +1145,2105 @@ namespace graphGen {
             return ret;
         }
 
-        /// 일자 그래프를 생성
-        /// 1--2 2--3 3--4 ... (n-1)--n 형태의 그래프를 의미
-        /// first_node와 last_node를 설정하면 차수가 1인 노드가 각각 first_node와 last_node인 그래프를 반환
-        static Graph path_graph(const int n, const int first_node = -1, const int last_node = -1) {
-            std::vector<int> arr(n);
-            for(int i = 0; i < n; i++) arr[i] = i+1;
-            shuffle(arr.begin(), arr.end());
-
-            if(first_node != -1) {
-                chk(1 <= first_node && first_node <= n, "first_node is not a valid node");
-                chk(first_node != last_node && n > 1, "first_node and last_node cannot be the same");
-                for(int i = 0; i < n; i++) if(arr[i] == first_node) std::swap(arr[0], arr[i]);
+        /**
+         * @brief streams the edges of an Erdos-Renyi G(n, p) graph to sink(u, v). <br>
+         * every pair is chosen independently with probability p.
+         * uses Batagelj-Brandes geometric skipping, so the graph never has to be stored.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param p the probability of each edge
+         * @param sink called as sink(u, v) for each generated edge
+         * @param directed if true, u -> v and v -> u are chosen independently. otherwise only u > v pairs are chosen.
+         */
+        template <typename Sink> static void gnp_stream(const int n, const double p, Sink&& sink, const bool directed = false) {
+            chk(n >= 1, "a graph must have at least one node");
+            chk(0.0 <= p && p <= 1.0, "p must be in [0, 1]");
+            if(p == 0.0) return;
+            const long long pairs = directed ? 1LL * n * (n - 1) : 1LL * n * (n - 1) / 2;
+            const double lp = std::log1p(-p);
+            // 다음 간선까지 건너뛸 쌍의 개수 (기하분포)
+            auto skip = [&]() -> long long { return p == 1.0 ? 0 : geometric_skip(lp, pairs); };
+
+            if(directed) {
+                for(long long idx = skip(); idx < pairs; idx += 1 + skip()) {
+                    int u = static_cast<int>(idx / (n - 1)), w = static_cast<int>(idx % (n - 1));
+                    sink(u + 1, (w < u ? w : w + 1) + 1);
+                }
+                return;
             }
-
-            if(last_node != -1) {
-                chk(1 <= last_node && last_node <= n, "last_node is not a valid node");
-                for(int i = 0; i < n; i++) if(arr[i] == last_node) std::swap(arr[n-1], arr[i]);
+            long long u = 1, w = -1;
+            while(u < n) {
+                w += 1 + skip();
+                while(w >= u && u < n) w -= u, u++;
+                if(u < n) sink(static_cast<int>(u) + 1, static_cast<int>(w) + 1);
             }
-
-            if(first_node != -1) assert(arr[0] == first_node);
-            if(last_node != -1) assert(arr[n-1] == last_node);
-
-            Graph ret(n);
-            for(int i = 0; i < n-1; i++) ret.add_edge(arr[i], arr[i+1]);
-            return ret;
         }
 
         /**
-         * @brief generates a complete graph of n nodes
+         * @brief generates an Erdos-Renyi G(n, p) graph
          *
-         * Time complexity: O(n^2 log n)
-         * @param n node count
-         * @return the complete graph
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param p the probability of each edge
+         * @param directed if true, u -> v and v -> u are chosen independently.
+         * @return the generated graph
          */
-        static Graph complete_graph(const int n) {
-            Graph ret(n);
-            for(int i = 1; i <= n; i++) for(int j = i+1; j <= n; j++) ret.add_edge(i, j);
+        static BasicGraph gnp(const int n, const double p, const bool directed = false) {
+            BasicGraph ret(n);
+            const double pairs = directed ? 1.0 * n * (n - 1) : 1.0 * n * (n - 1) / 2;
+            ret.edges.reserve(static_cast<size_t>(pairs * p * 1.05) + 16);
+            gnp_stream(n, p, [&](int a, int b) { ret.add_edge(a, b); }, directed);
             return ret;
         }
 
         /**
-         * @brief generates a star graph of n nodes
+         * @brief generates a Barabasi-Albert graph grown from a seed graph. <br>
+         * nodes seed.V()+1 .. n are added in order, and each of them is connected to k existing nodes
+         * chosen with probability proportional to their degree.
+         * the sampling uses the repeated-nodes array, so each attachment is O(1).
          *
-         * Time complexity: O(n log n)
-         * @param n node count
-         * @param root the node to which all other nodes are connected
-         * @return the complete graph
+         * Time complexity: O(seed.E() + n * k) expected
+         * @param seed the initial graph. its nodes keep their numbers unless permute is true.
+         * @param n the node count
+         * @param k the number of edges added with each new node
+         * @param distinct_edges if true, a new node never connects to the same node twice.
+         * @param permute if true, the node numbers are shuffled at the end. otherwise older nodes (the hubs) have smaller numbers.
+         * @return the generated graph
          */
-        static Graph star_graph(const int n, const int root = 1) {
-            Graph ret(n);
-            for(int i = 1; i <= n; i++) if(i != root) ret.add_edge(root, i);
-            return ret;
-        }
+        static BasicGraph preferential_attachment(const BasicGraph& seed, const int n, const int k, const bool distinct_edges = false,
+                                                  const bool permute = true) {
+            const int s = seed.V();
+            chk(1 <= s && s <= n, "the seed graph must have between 1 and n nodes");
+            chk(k >= 1, "k must be positive");
+            chk(!distinct_edges || k <= s, "k cannot be greater than the seed node count if edges are distinct");
+
+            BasicGraph ret(n);
+            const long long m = seed.E() + 1LL * (n - s) * k;
+            ret.edges.reserve(m);
+            // 노드 u가 차수만큼 들어 있는 배열. 여기서 균등하게 뽑으면 차수에 비례하는 확률로 뽑힘
+            std::vector<int> repeated;
+            repeated.reserve(2 * m + s);
+            std::vector<bool> touched(s + 1, false);
+            for(const auto& [a, b] : seed.edges) {
+                ret.add_edge(a, b);
+                repeated.push_back(a), repeated.push_back(b);
+                touched[a] = touched[b] = true;
+            }
+            // 간선이 없는 seed 노드도 선택될 수 있도록 한 번씩 넣어 줌
+            for(int i = 1; i <= s; i++) if(!touched[i]) repeated.push_back(i);
 
-        // path graph에서 리프 노드가 아닌 모든 노드에 리프 노드 하나를 이은 그래프
-        static Graph skeleton_tree(const int n) {
-            chk(n % 2 == 0, "node count must be even at skeleton graph");
-            int line_len = n / 2 + 1;
-            Graph g(n);
-            for(int i = 2; i <= line_len; i++) g.add_edge(i - 1, i);
-            for(int i = 2; i <= line_len - 1; i++) g.add_edge(i, line_len + i - 1);
-            return g;
+            EdgeIndex index;
+            if(distinct_edges) {
+                index = EdgeIndex(m);
+                for(const auto& [a, b] : seed.edges) index.insert_undir(a, b);
+            }
+            for(int v = s + 1; v <= n; v++) {
+                const int sz = static_cast<int>(repeated.size());
+                for(int j = 0; j < k; j++) {
+                    int u = repeated[rnd.next(sz)];
+                    if(distinct_edges) while(!index.insert_undir(u, v)) u = repeated[rnd.next(sz)];
+                    ret.add_edge(v, u);
+                    repeated.push_back(u);
+                }
+                for(int j = 0; j < k; j++) repeated.push_back(v);
+            }
+            return permute ? ret.nodes_shuffled() : ret;
         }
 
-        // 노드개수 간선개수
+        /**
+         * @brief generates a Barabasi-Albert graph. <br>
+         * starts from the complete graph of k+1 nodes.
+         *
+         * Time complexity: O(k^2 + n * k) expected
+         * @param n the node count
+         * @param k the number of edges added with each new node
+         * @param distinct_edges if true, a new node never connects to the same node twice.
+         * @param permute if true, the node numbers are shuffled at the end. otherwise older nodes (the hubs) have smaller numbers.
+         * @return the generated graph
+         */
+        static BasicGraph preferential_attachment(const int n, const int k, const bool distinct_edges = false, const bool permute = true) {
+            chk(1 <= k && k < n, "k must be in [1, n-1]");
+            return preferential_attachment(complete_graph(k + 1), n, k, distinct_edges, permute);
+        }
+
+        /**
+         * @brief generates an R-MAT (stochastic Kronecker) graph of 2^scale nodes. <br>
+         * each edge picks one of the four quadrants of the adjacency matrix with probabilities a, b, c, 1-a-b-c, scale times.
+         * self-loops and duplicate edges are kept, as in the original R-MAT model.
+         *
+         * Time complexity: O(n + m * scale), where m = edge_factor * 2^scale
+         * @param scale log2 of the node count
+         * @param edge_factor the number of edges per node
+         * @param a the probability of the top-left quadrant
+         * @param b the probability of the top-right quadrant
+         * @param c the probability of the bottom-left quadrant
+         * @param noise if positive, the probabilities of each level are perturbed by up to this amount (NSKG noise).
+         * @param permute if true, the node numbers are shuffled with nodes_shuffled(), so hubs are not the smallest nodes.
+         * @param threads the number of threads generating edges. the result does not depend on it.
+         * @return the generated graph
+         */
+        static BasicGraph rmat(const int scale, const int edge_factor, const double a, const double b, const double c,
+                          const double noise = 0.0, const bool permute = true, const int threads = 1) {
+            chk(0 <= scale && scale <= 30, "scale must be in [0, 30]");
+            chk(edge_factor >= 0, "edge_factor must not be negative");
+            chk(a >= 0 && b >= 0 && c >= 0 && a + b + c <= 1.0, "invalid quadrant probabilities");
+            chk(threads >= 1, "threads must be positive");
+            const int n = 1 << scale;
+            const long long m = 1LL * edge_factor * n;
+            chk(m <= INT_MAX, "too many edges");
+
+            const double d = 1.0 - a - b - c;
+            chk(noise >= 0 && noise <= std::min({b, c, (a + d) / 2}), "noise is too large");
+
+            // 레벨마다 [a, a+b, a+b+c]의 누적 확률
+            std::vector<std::array<double, 3>> prob(scale);
+            for(int l = 0; l < scale; l++) {
+                double mu = noise > 0 ? rnd.next(-noise, noise) : 0.0;
+                // a + d = 0이면 noise도 0이므로 a, d를 조정하지 않음 (0 / 0 방지)
+                double na = a, nb = b + mu, nc = c + mu, nd = d;
+                if(a + d > 0) na -= 2 * mu * a / (a + d), nd -= 2 * mu * d / (a + d);
+                double sum = na + nb + nc + nd;
+                prob[l] = {na / sum, (na + nb) / sum, (na + nb + nc) / sum};
+            }
+
+            // 청크마다 독립적인 random_t를 사용하므로 스레드 수와 관계없이 같은 결과가 나옴
+            constexpr long long CHUNK = 1 << 16;
+            const long long chunks = (m + CHUNK - 1) / CHUNK;
+            std::vector<long long> seeds(chunks);
+            for(auto& sd : seeds) sd = rnd.next(LLONG_MAX);
+
+            std::vector<std::pair<int, int>> buf(m);
+            auto work = [&](const int t) {
+                random_t gen;
+                for(long long ch = t; ch < chunks; ch += threads) {
+                    gen.setSeed(seeds[ch]);
+                    for(long long i = ch * CHUNK; i < std::min(m, (ch + 1) * CHUNK); i++) {
+                        int u = 0, w = 0;
+                        for(int l = 0; l < scale; l++) {
+                            const double r = gen.next();
+                            const int bit = 1 << (scale - 1 - l);
+                            if(r < prob[l][0]) continue;
+                            if(r < prob[l][1]) w |= bit;
+                            else if(r < prob[l][2]) u |= bit;
+                            else u |= bit, w |= bit;
+                        }
+                        buf[i] = {u + 1, w + 1};
+                    }
+                }
+            };
+            if(threads == 1) work(0);
+            else {
+                std::vector<std::thread> pool;
+                for(int t = 0; t < threads; t++) pool.emplace_back(work, t);
+                for(auto& th : pool) th.join();
+            }
+
+            BasicGraph ret = from_edge_buffer(n, std::move(buf));
+            return permute ? ret.nodes_shuffled() : ret;
+        }
+
+        /**
+         * @brief generates a random d-regular graph using the pairing (configuration) model. <br>
+         * self-loops and duplicate edges of the pairing are repaired by switching endpoints
+         * with a random valid edge. if a bad edge finds no valid switch in 1000 draws, the pairing is redone.
+         * if d > (n-1)/2, the complement of a random (n-1-d)-regular graph is returned.
+         *
+         * Time complexity: O(n * d) expected for d <= (n-1)/2, O(n^2) otherwise
+         * @param n the node count
+         * @param d the degree of every node
+         * @return the generated graph
+         */
+        static BasicGraph random_regular(const int n, const int d) {
+            chk(n >= 1, "a graph must have at least one node");
+            chk(0 <= d && d < n, "d must be in [0, n-1]");
+            chk(1LL * n * d % 2 == 0, "n * d must be even");
+            const long long m = 1LL * n * d / 2;
+            chk(m <= INT_MAX, "too many edges");
+
+            if(d > (n - 1) / 2) {
+                BasicGraph comp = random_regular(n, n - 1 - d);
+                std::vector<std::vector<int>> adj = comp.adjacency_list_undir();
+                std::vector<std::pair<int, int>> buf;
+                buf.reserve(m);
+                std::vector<bool> mark(n + 1, false);
+                for(int u = 1; u <= n; u++) {
+                    for(int w : adj[u]) mark[w] = true;
+                    for(int w = u + 1; w <= n; w++) if(!mark[w]) buf.emplace_back(u, w);
+                    for(int w : adj[u]) mark[w] = false;
+                }
+                return from_edge_buffer(n, std::move(buf));
+            }
+
+            std::vector<int> points(2 * m);
+            for(long long i = 0; i < 2 * m; i++) points[i] = static_cast<int>(i / d) + 1;
+            // 작은 그래프에서는 가능한 교환이 없을 수 있으므로, 시도 횟수를 넘기면 처음부터 다시 짝지음
+            constexpr int max_attempts = 1000;
+            while(true) {
+                shuffle(points.begin(), points.end());
+
+                std::vector<std::pair<int, int>> buf(m);
+                std::vector<bool> ok(m, true);
+                std::vector<int> bad;
+                EdgeIndex index(m);
+                for(int i = 0; i < m; i++) {
+                    const int a = points[2 * i], b = points[2 * i + 1];
+                    buf[i] = {a, b};
+                    if(a == b || !index.insert_undir(a, b)) ok[i] = false, bad.push_back(i);
+                }
+
+                // 잘못된 간선 (a, b)와 정상 간선 (x, y)를 (a, x), (b, y)로 바꿔도 차수는 그대로 유지됨
+                bool repaired = true;
+                for(const int i : bad) {
+                    const auto [a, b] = buf[i];
+                    int attempts = 0;
+                    while(!ok[i] && attempts++ < max_attempts) {
+                        const int j = rnd.next(static_cast<int>(m));
+                        if(!ok[j]) continue;
+                        auto [x, y] = buf[j];
+                        if(rnd.next(2)) std::swap(x, y);
+                        if(a == x || b == y || (a == y && b == x)) continue;
+                        if(index.contains_undir(a, x) || index.contains_undir(b, y)) continue;
+                        index.erase_undir(x, y);
+                        index.insert_undir(a, x), index.insert_undir(b, y);
+                        buf[j] = {a, x}, buf[i] = {b, y};
+                        ok[i] = true;
+                    }
+                    if(!ok[i]) { repaired = false; break; }
+                }
+                if(repaired) return from_edge_buffer(n, std::move(buf));
+            }
+        }
+
+        /**
+         * @brief checks whether a degree sequence is graphical with the Erdos-Gallai test
+         *
+         * Time complexity: O(n)
+         * @param deg deg[i] is the degree of node i+1
+         * @return whether a simple undirected graph with these degrees exists
+         */
+        static bool is_graphical(const std::vector<int>& deg) {
+            const int n = static_cast<int>(deg.size());
+            long long total = 0;
+            std::vector<int> cnt(n + 1, 0);
+            for(const int x : deg) {
+                if(x < 0 || x >= std::max(n, 1)) return false;
+                cnt[x]++, total += x;
+            }
+            if(total % 2) return false;
+
+            // 내림차순 정렬 (counting sort)
+            std::vector<long long> d(n + 1, 0), pre(n + 1, 0);
+            for(int x = n - 1, i = 1; x >= 0; x--) while(cnt[x]--) d[i++] = x;
+            for(int i = 1; i <= n; i++) pre[i] = pre[i - 1] + d[i];
+
+            // q: d[i] >= k 인 i의 개수. k가 커질수록 줄어듦
+            int q = n;
+            for(int k = 1; k <= n; k++) {
+                while(q > 0 && d[q] < k) q--;
+                const int bound = std::max(q, k);
+                const long long rhs = 1LL * k * (k - 1) + 1LL * k * (bound - k) + (pre[n] - pre[bound]);
+                if(pre[k] > rhs) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief generates a graph with the exact degree sequence, using the Havel-Hakimi algorithm. <br>
+         * nodes are kept in a bucketed array sorted by remaining degree, so each step is O(degree).
+         * the result can be randomised with degree-preserving double-edge swaps.
+         *
+         * Time complexity: O(n + m + swaps) expected
+         * @param deg deg[i] is the degree of node i+1
+         * @param swaps the number of attempted double-edge swaps
+         * @return the generated graph
+         */
+        static BasicGraph from_degree_sequence(const std::vector<int>& deg, const int swaps = 0) {
+            chk(!deg.empty(), "a graph must have at least one node");
+            chk(is_graphical(deg), "the degree sequence is not graphical");
+            const int n = static_cast<int>(deg.size());
+
+            // a: 남은 차수 내림차순으로 정렬된 노드 배열 (같은 차수끼리는 무작위 순서)
+            std::vector<int> res(n + 1), order(n), a(n), cnt(n + 1, 0);
+            for(int i = 0; i < n; i++) res[i + 1] = deg[i], cnt[deg[i]]++, order[i] = i + 1;
+            shuffle(order.begin(), order.end());
+            // end_ge[k]: 남은 차수가 k 이상인 노드들의 구간 [.., end_ge[k])의 끝
+            std::vector<int> end_ge(n + 1, 0);
+            for(int k = n - 1; k >= 0; k--) end_ge[k] = end_ge[k + 1] + cnt[k];
+            std::vector<int> fill(end_ge.begin() + 1, end_ge.end());
+            for(const int u : order) a[fill[res[u]]++] = u;
+
+            std::vector<std::pair<int, int>> buf;
+            long long m = 0;
+            for(const int x : deg) m += x;
+            buf.reserve(m / 2);
+            for(int start = 0; start < n; start++) {
+                const int u = a[start], du = res[u];
+                if(du == 0) break;
+                res[u] = 0;
+                for(int i = 1; i <= du; i++) buf.emplace_back(u, a[start + i]);
+                // 뒤에서부터 차수를 줄이면서 같은 차수 구간의 끝으로 보내면 정렬이 유지됨
+                for(int i = du; i >= 1; i--) {
+                    const int pos = start + i, w = a[pos];
+                    const int e = --end_ge[res[w]];
+                    std::swap(a[pos], a[e]);
+                    res[w]--;
+                }
+            }
+
+            if(swaps > 0 && buf.size() >= 2U) {
+                EdgeIndex index(buf.size());
+                for(const auto& [x, y] : buf) index.insert_undir(x, y);
+                const int sz = static_cast<int>(buf.size());
+                for(int t = 0; t < swaps; t++) {
+                    const int i = rnd.next(sz), j = rnd.next(sz);
+                    if(i == j) continue;
+                    auto [x1, y1] = buf[i];
+                    auto [x2, y2] = buf[j];
+                    if(rnd.next(2)) std::swap(x2, y2);
+                    // (x1, y1), (x2, y2) -> (x1, y2), (x2, y1)
+                    if(x1 == y2 || x2 == y1 || index.contains_undir(x1, y2) || index.contains_undir(x2, y1)) continue;
+                    index.erase_undir(x1, y1), index.erase_undir(x2, y2);
+                    index.insert_undir(x1, y2), index.insert_undir(x2, y1);
+                    buf[i] = {x1, y2}, buf[j] = {x2, y1};
+                }
+            }
+            return from_edge_buffer(n, std::move(buf));
+        }
+
+        /// @returns 합이 2m인 그래프로 만들 수 있는(graphical) 길이 n의 차수열
+        /// skew가 클수록 차수가 큰 노드가 많아짐 (rnd.wnext의 type과 같음)
+        /// m이 n(n-1)/4보다 크면 중복 간선을 다시 뽑는 횟수가 많아짐
+        static std::vector<int> random_graphical_sequence(const int n, const int m, const int skew = 0) {
+            chk(n >= 1, "count must be greater than zero.");
+            chk(0 <= m && m <= 1LL * n * (n - 1) / 2, "edge count is too large");
+            std::vector<int> result(n, 0);
+            EdgeIndex index(m);
+            for(int r = 0; r < m; r++) {
+                int u, w;
+                do {
+                    u = rnd.wnext(n, skew);
+                    w = rnd.next(n);
+                } while(u == w || !index.insert_undir(u, w));
+                result[u]++, result[w]++;
+            }
+            shuffle(result.begin(), result.end());
+            return result;
+        }
+
+        /**
+         * @brief generates a random DAG with m distinct edges. <br>
+         * the edges follow a hidden random topological order.
+         * if layers > 0, the nodes are split into that many layers in topological order,
+         * there are no edges inside a layer, and an edge goes at most max_span layers forward.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param layers the number of layers. 0 means no layering.
+         * @param max_span the maximum number of layers an edge can skip forward. 0 means no limit.
+         * @return the generated DAG
+         */
+        static BasicGraph random_dag(const int n, const int m, const int layers = 0, const int max_span = 0) {
+            chk(n >= 1, "a graph must have at least one node");
+            chk(0 <= layers && layers <= n, "layers must be in [0, n]");
+            chk(max_span >= 0, "max_span must not be negative");
+            chk(m >= 0, "edge count must not be negative");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+
+            if(layers == 0) {
+                chk(0 <= m && m <= 1LL * n * (n - 1) / 2, "edge count is too large");
+                for(const long long idx : sample_distinct(m, 1LL * n * (n - 1) / 2)) {
+                    const auto [a, b] = pair_from_index(idx);
+                    buf.emplace_back(a + 1, b + 1);
+                }
+            } else {
+                const int span = max_span == 0 ? layers - 1 : std::min(max_span, layers - 1);
+                // first[t]: t번째 층의 첫 노드 (0-based), pre[t]: t번째 층 이전까지의 (u, w) 쌍의 개수
+                std::vector<int> sizes = distribute_natural_numbers(n, layers), first(layers + 1, 0);
+                for(int t = 0; t < layers; t++) first[t + 1] = first[t] + sizes[t];
+                std::vector<long long> pre(layers + 1, 0), width(layers, 0);
+                for(int t = 0; t < layers; t++) {
+                    width[t] = first[std::min(layers, t + span + 1)] - first[t + 1];
+                    pre[t + 1] = pre[t] + 1LL * sizes[t] * width[t];
+                }
+                chk(0 <= m && m <= pre[layers], "edge count is too large for the layers");
+                for(const long long idx : sample_distinct(m, pre[layers])) {
+                    const int t = static_cast<int>(std::upper_bound(pre.begin(), pre.end(), idx) - pre.begin()) - 1;
+                    const long long off = idx - pre[t];
+                    buf.emplace_back(first[t] + static_cast<int>(off / width[t]) + 1, first[t + 1] + static_cast<int>(off % width[t]) + 1);
+                }
+            }
+
+            BasicGraph ret = from_edge_buffer(n, std::move(buf)).nodes_shuffled();
+            return ret.shuffle_edge_list();
+        }
+
+        /**
+         * @brief generates a strongly connected directed graph with m distinct edges. <br>
+         * the base is a random Hamiltonian cycle if ear_count is 0,
+         * or a random cycle with ear_count directed ears (paths of new nodes between existing nodes) otherwise.
+         * the remaining edges are random, checked for duplicates in O(1).
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param ear_count the number of ears in the base ear decomposition
+         * @return the generated graph
+         */
+        static BasicGraph strongly_connected(const int n, const int m, const int ear_count = 0) {
+            chk(n >= 2, "a strongly connected graph must have at least two nodes");
+            chk(0 <= ear_count && ear_count <= n - 2, "ear_count must be in [0, n-2]");
+            chk(n + ear_count <= m, "edge count is too small");
+            chk(m <= 1LL * n * (n - 1), "edge count is too large");
+
+            std::vector<int> perm(n);
+            for(int i = 0; i < n; i++) perm[i] = i + 1;
+            shuffle(perm.begin(), perm.end());
+
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            auto push = [&](const int a, const int b) { index.insert(a, b); buf.emplace_back(a, b); };
+
+            // 처음 cycle_len개의 노드로 사이클을 만들고, 남은 노드들은 귀(ear)로 붙임
+            const int ear_nodes = ear_count ? rnd.next(ear_count, n - 2) : 0;
+            const int cycle_len = n - ear_nodes;
+            for(int i = 0; i < cycle_len; i++) push(perm[i], perm[(i + 1) % cycle_len]);
+            if(ear_count) {
+                int cur = cycle_len;
+                for(const int len : distribute_natural_numbers(ear_nodes, ear_count)) {
+                    const int from = perm[rnd.next(cur)], to = perm[rnd.next(cur)];
+                    push(from, perm[cur]);
+                    for(int j = 1; j < len; j++) push(perm[cur + j - 1], perm[cur + j]);
+                    push(perm[cur + len - 1], to);
+                    cur += len;
+                }
+            }
+
+            while(static_cast<int>(buf.size()) < m) {
+                const int a = rnd.next(n) + 1, b = rnd.next(n) + 1;
+                if(a != b && !index.contains(a, b)) push(a, b);
+            }
+            return from_edge_buffer(n, std::move(buf)).shuffle_edge_list();
+        }
+
+        /**
+         * @brief generates a directed graph with exactly k strongly connected components of random sizes. <br>
+         * each component is built with strongly_connected(), and the components are joined
+         * by random edges that follow a hidden topological order of the condensation.
+         * the sizes are redrawn until they can hold m edges. m is valid if it is in
+         * [n-k+1 (0 if n = k), n(n-1)/2 + (n-k+1)(n-k)/2].
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param k the number of strongly connected components
+         * @return the generated graph
+         */
+        static BasicGraph planted_scc(const int n, const int m, const int k) {
+            chk(1 <= k && k <= n, "k must be in [1, n]");
+            // 크기 sz >= 2인 컴포넌트는 간선이 sz개 이상, sz(sz-1)개 이하 필요
+            auto range = [&](const std::vector<int>& sizes) {
+                long long lo = 0, hi = 1LL * n * (n - 1) / 2;
+                for(const int sz : sizes) {
+                    if(sz >= 2) lo += sz;
+                    hi += 1LL * sz * (sz - 1) / 2;
+                }
+                return std::pair{lo, hi};
+            };
+            // 크기가 n-k+1인 컴포넌트 하나와 나머지 한 개짜리 컴포넌트들이 가능한 m의 범위가 가장 넓음
+            std::vector<int> widest(k, 1);
+            widest[0] = n - k + 1;
+            const auto [min_m, max_m] = range(widest);
+            chk(min_m <= m && m <= max_m, "edge count is out of range");
+            // 무작위 크기가 m을 담지 못하면 다시 뽑고, 여러 번 실패하면 가장 넓은 분할을 섞어서 씀
+            std::vector<int> sizes;
+            for(int attempt = 0; ; attempt++) {
+                if(attempt == 64) {
+                    sizes = widest;
+                    shuffle(sizes.begin(), sizes.end());
+                    break;
+                }
+                sizes = distribute_natural_numbers(n, k);
+                const auto [lo, hi] = range(sizes);
+                if(lo <= m && m <= hi) break;
+            }
+
+            // comp[u]: u가 속한 컴포넌트. 컴포넌트 번호 순서가 축약 그래프의 위상 정렬 순서
+            std::vector<int> comp(n + 1), first(k + 1, 1);
+            for(int c = 0; c < k; c++) {
+                first[c + 1] = first[c] + sizes[c];
+                for(int u = first[c]; u < first[c + 1]; u++) comp[u] = c;
+            }
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            for(int c = 0; c < k; c++) if(sizes[c] >= 2) {
+                for(const auto& [a, b] : strongly_connected(sizes[c], sizes[c]).edges) {
+                    index.insert(a + first[c] - 1, b + first[c] - 1);
+                    buf.emplace_back(a + first[c] - 1, b + first[c] - 1);
+                }
+            }
+            while(static_cast<int>(buf.size()) < m) {
+                int a = rnd.next(n) + 1, b = rnd.next(n) + 1;
+                if(a == b) continue;
+                if(comp[a] > comp[b]) std::swap(a, b);
+                if(index.insert(a, b)) buf.emplace_back(a, b);
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf)).nodes_shuffled();
+            return ret.shuffle_edge_list();
+        }
+
+        /**
+         * @brief generates a random bipartite graph with m distinct edges between parts of size n1 and n2. <br>
+         * the node numbers are shuffled, so the parts are hidden.
+         * if degree bounds are given, a pair that is already used is replaced by an endpoint switch with a random edge.
+         *
+         * Time complexity: O(n1 + n2 + m) expected
+         * @param n1 the size of the first part
+         * @param n2 the size of the second part
+         * @param m the edge count
+         * @param max_deg1 the maximum degree of the nodes in the first part. 0 means no limit.
+         * @param max_deg2 the maximum degree of the nodes in the second part. 0 means no limit.
+         * @return the generated graph
+         */
+        static BasicGraph bipartite(const int n1, const int n2, const int m, const int max_deg1 = 0, const int max_deg2 = 0) {
+            chk(n1 >= 1 && n2 >= 1, "both parts must have at least one node");
+            chk(max_deg1 >= 0 && max_deg2 >= 0, "degree bounds must not be negative");
+            const int cap1 = max_deg1 ? std::min(max_deg1, n2) : n2, cap2 = max_deg2 ? std::min(max_deg2, n1) : n1;
+            chk(0 <= m && m <= std::min(1LL * n1 * cap1, 1LL * n2 * cap2), "edge count is too large");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+
+            if(cap1 == n2 && cap2 == n1) {
+                for(const long long idx : sample_distinct(m, 1LL * n1 * n2))
+                    buf.emplace_back(static_cast<int>(idx / n2) + 1, n1 + static_cast<int>(idx % n2) + 1);
+            } else {
+                // 아직 차수에 여유가 있는 노드들
+                std::vector<int> free1(n1), free2(n2), left(n1 + n2 + 1);
+                for(int i = 0; i < n1; i++) free1[i] = i + 1, left[i + 1] = cap1;
+                for(int i = 0; i < n2; i++) free2[i] = n1 + i + 1, left[n1 + i + 1] = cap2;
+                EdgeIndex index(m);
+                auto use = [&](std::vector<int>& f, const int i) {
+                    if(--left[f[i]] == 0) std::swap(f[i], f.back()), f.pop_back();
+                };
+                while(static_cast<int>(buf.size()) < m) {
+                    const int i = rnd.next(static_cast<int>(free1.size())), j = rnd.next(static_cast<int>(free2.size()));
+                    const int u = free1[i], w = free2[j];
+                    if(index.insert(u, w)) buf.emplace_back(u, w);
+                    else {
+                        // (x, y) -> (u, y), (x, w): x와 y의 차수는 그대로이고 u와 w의 차수만 1씩 늘어남
+                        const int k = rnd.next(static_cast<int>(buf.size()));
+                        const auto [x, y] = buf[k];
+                        if(x == u || y == w || index.contains(u, y) || index.contains(x, w)) continue;
+                        index.erase(x, y), index.insert(u, y), index.insert(x, w);
+                        buf[k] = {u, y}, buf.emplace_back(x, w);
+                    }
+                    use(free1, i), use(free2, j);
+                }
+            }
+            BasicGraph ret = from_edge_buffer(n1 + n2, std::move(buf)).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a connected random bipartite graph with m distinct edges. <br>
+         * a random spanning tree that alternates between the parts is built first.
+         *
+         * Time complexity: O(n1 + n2 + m) expected
+         * @param n1 the size of the first part
+         * @param n2 the size of the second part
+         * @param m the edge count
+         * @return the generated graph
+         */
+        static BasicGraph bipartite_connected(const int n1, const int n2, const int m) {
+            chk(n1 >= 1 && n2 >= 1, "both parts must have at least one node");
+            chk(n1 + n2 - 1 <= m && m <= 1LL * n1 * n2, "edge count is out of range");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            auto push = [&](const int a, const int b) { index.insert(a, b); buf.emplace_back(a, b); };
+
+            std::vector<int> order;
+            order.reserve(n1 + n2 - 2);
+            for(int u = 2; u <= n1 + n2; u++) if(u != n1 + 1) order.push_back(u);
+            shuffle(order.begin(), order.end());
+            std::vector<int> placed1{1}, placed2{n1 + 1};
+            placed1.reserve(n1), placed2.reserve(n2);
+            push(1, n1 + 1);
+            for(const int u : order) {
+                if(u <= n1) push(u, rnd.any(placed2)), placed1.push_back(u);
+                else push(rnd.any(placed1), u), placed2.push_back(u);
+            }
+            while(static_cast<int>(buf.size()) < m) {
+                const int a = rnd.next(n1) + 1, b = n1 + rnd.next(n2) + 1;
+                if(!index.contains(a, b)) push(a, b);
+            }
+            BasicGraph ret = from_edge_buffer(n1 + n2, std::move(buf)).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a random bipartite graph with two parts of n nodes that has a perfect matching. <br>
+         * a random perfect matching is planted first.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the size of each part
+         * @param m the edge count
+         * @return the generated graph
+         */
+        static BasicGraph bipartite_with_perfect_matching(const int n, const int m) {
+            chk(n >= 1, "both parts must have at least one node");
+            chk(n <= m && m <= 1LL * n * n, "edge count is out of range");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            std::vector<int> perm(n);
+            for(int i = 0; i < n; i++) perm[i] = n + i + 1;
+            shuffle(perm.begin(), perm.end());
+            for(int i = 0; i < n; i++) index.insert(i + 1, perm[i]), buf.emplace_back(i + 1, perm[i]);
+            while(static_cast<int>(buf.size()) < m) {
+                const int a = rnd.next(n) + 1, b = n + rnd.next(n) + 1;
+                if(index.insert(a, b)) buf.emplace_back(a, b);
+            }
+            BasicGraph ret = from_edge_buffer(2 * n, std::move(buf)).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief streams the edges of an r x c lattice to sink(u, v) in row-major order. <br>
+         * the cell (i, j) (0-based) is node i * c + j + 1.
+         *
+         * Time complexity: O(r * c)
+         * @param r the number of rows
+         * @param c the number of columns
+         * @param wrap if true, the first and last rows (and columns) are adjacent (torus)
+         * @param king if true, diagonal neighbours are adjacent too (8 neighbours)
+         * @param sink called as sink(u, v) for each edge
+         */
+        template <typename Sink> static void lattice_stream(const int r, const int c, const bool wrap, const bool king, Sink&& sink) {
+            chk(r >= 1 && c >= 1, "a lattice must have at least one row and column");
+            chk(1LL * r * c <= INT_MAX, "too many nodes");
+            chk(!wrap || (r >= 3 && c >= 3), "a torus must have at least three rows and columns");
+            for(int i = 0; i < r; i++) {
+                const int down = i + 1 < r ? i + 1 : (wrap ? 0 : -1);
+                for(int j = 0; j < c; j++) {
+                    const int right = j + 1 < c ? j + 1 : (wrap ? 0 : -1), left = j > 0 ? j - 1 : (wrap ? c - 1 : -1);
+                    const int u = i * c + j + 1;
+                    if(right != -1) sink(u, i * c + right + 1);
+                    if(down == -1) continue;
+                    sink(u, down * c + j + 1);
+                    if(!king) continue;
+                    if(right != -1) sink(u, down * c + right + 1);
+                    if(left != -1) sink(u, down * c + left + 1);
+                }
+            }
+        }
+
+        /**
+         * @brief generates an r x c grid graph. the cell (i, j) (0-based) is node i * c + j + 1.
+         *
+         * Time complexity: O(r * c)
+         * @param r the number of rows
+         * @param c the number of columns
+         * @param king if true, diagonal neighbours are adjacent too (8 neighbours)
+         * @return the grid graph
+         */
+        static BasicGraph grid(const int r, const int c, const bool king = false) {
+            chk(r >= 1 && c >= 1, "a lattice must have at least one row and column");
+            chk(1LL * r * c <= INT_MAX, "too many nodes");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(1LL * r * (c - 1) + 1LL * (r - 1) * c + (king ? 2LL * (r - 1) * (c - 1) : 0));
+            lattice_stream(r, c, false, king, [&](int a, int b) { buf.emplace_back(a, b); });
+            return from_edge_buffer(r * c, std::move(buf), true);
+        }
+
+        /**
+         * @brief generates an r x c torus graph. the cell (i, j) (0-based) is node i * c + j + 1.
+         *
+         * Time complexity: O(r * c)
+         * @param r the number of rows, at least 3
+         * @param c the number of columns, at least 3
+         * @param king if true, diagonal neighbours are adjacent too (8 neighbours)
+         * @return the torus graph
+         */
+        static BasicGraph torus(const int r, const int c, const bool king = false) {
+            chk(r >= 3 && c >= 3, "a torus must have at least three rows and columns");
+            chk(1LL * r * c <= INT_MAX, "too many nodes");
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve((king ? 4LL : 2LL) * r * c);
+            lattice_stream(r, c, true, king, [&](int a, int b) { buf.emplace_back(a, b); });
+            return from_edge_buffer(r * c, std::move(buf), true);
+        }
+
+        /**
+         * @brief generates an r x c grid with random obstacles, whose open cells are connected. <br>
+         * each cell is blocked with probability obstacle_ratio. then a single BFS over a packed bitmap
+         * from a random open cell blocks every open cell it cannot reach.
+         *
+         * Time complexity: O(r * c)
+         * @param r the number of rows
+         * @param c the number of columns
+         * @param obstacle_ratio the probability that a cell is blocked
+         * @param king if true, diagonal neighbours are adjacent too (8 neighbours)
+         * @return the graph of open cells numbered 1..k in row-major order, and the map ('.' open, '#' blocked)
+         */
+        static std::pair<BasicGraph, std::vector<std::string>> grid_with_obstacles(const int r, const int c, const double obstacle_ratio, const bool king = false) {
+            chk(r >= 1 && c >= 1, "a lattice must have at least one row and column");
+            chk(1LL * r * c <= INT_MAX, "too many nodes");
+            chk(0.0 <= obstacle_ratio && obstacle_ratio <= 1.0, "obstacle_ratio must be in [0, 1]");
+            const int cells = r * c;
+            std::vector<unsigned long long> open((cells + 63) / 64, 0), seen((cells + 63) / 64, 0);
+            auto get = [](const std::vector<unsigned long long>& bits, const int x) { return bits[x >> 6] >> (x & 63) & 1; };
+            auto set = [](std::vector<unsigned long long>& bits, const int x) { bits[x >> 6] |= 1ULL << (x & 63); };
+
+            std::vector<int> open_cells;
+            for(int x = 0; x < cells; x++) if(rnd.next() >= obstacle_ratio) set(open, x), open_cells.push_back(x);
+            const int start = open_cells.empty() ? rnd.next(cells) : rnd.any(open_cells);
+            set(open, start);
+            open_cells.clear();
+            open_cells.shrink_to_fit();
+
+            const int dr[8] = {0, 1, 0, -1, 1, 1, -1, -1}, dc[8] = {1, 0, -1, 0, 1, -1, 1, -1};
+            std::vector<int> queue{start};
+            set(seen, start);
+            for(size_t h = 0; h < queue.size(); h++) {
+                const int i = queue[h] / c, j = queue[h] % c;
+                for(int d = 0; d < (king ? 8 : 4); d++) {
+                    const int ni = i + dr[d], nj = j + dc[d];
+                    if(ni < 0 || ni >= r || nj < 0 || nj >= c) continue;
+                    const int y = ni * c + nj;
+                    if(get(open, y) && !get(seen, y)) set(seen, y), queue.push_back(y);
+                }
+            }
+
+            // 도달한 칸에만 행 우선 순서로 번호를 붙임
+            std::vector<int> label(cells, 0);
+            std::vector<std::string> mask(r, std::string(c, '#'));
+            int k = 0;
+            for(int x = 0; x < cells; x++) if(get(seen, x)) label[x] = ++k, mask[x / c][x % c] = '.';
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(king ? 4LL * k : 2LL * k);
+            lattice_stream(r, c, false, king, [&](int a, int b) {
+                if(label[a - 1] && label[b - 1]) buf.emplace_back(label[a - 1], label[b - 1]);
+            });
+            return {from_edge_buffer(k, std::move(buf), true), mask};
+        }
+
+        /**
+         * @brief generates a uniformly random full binary tree with the given number of leaves, using Remy's algorithm. <br>
+         * every internal node has exactly two children. the root is node 1, other numbers are random.
+         *
+         * Time complexity: O(leaves)
+         * @param leaves the number of leaves. the tree has 2 * leaves - 1 nodes.
+         * @return the generated tree
+         */
+        static BasicGraph binary_tree(const int leaves) {
+            chk(1 <= leaves && leaves <= INT_MAX / 2, "leaves must be in [1, INT_MAX / 2]");
+            const int n = 2 * leaves - 1;
+            std::vector<int> par(n, -1);
+            // 임의의 노드 x 위에 내부 노드 y를 끼워 넣고, y의 다른 자식으로 새 리프 z를 붙임
+            for(int k = 1; k < leaves; k++) {
+                const int x = rnd.next(2 * k - 1), y = 2 * k - 1, z = 2 * k;
+                par[y] = par[x], par[x] = y, par[z] = y;
+            }
+            return from_parent_array(par);
+        }
+
+        /**
+         * @brief generates a random tree whose nodes have degree at most d. <br>
+         * each new node picks its parent uniformly among the nodes that still have a free slot.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param d the maximum degree
+         * @return the generated tree
+         */
+        static BasicGraph tree_max_degree(const int n, const int d) {
+            chk(n >= 1, "a graph must have at least one node");
+            chk(d >= 2 || (d == 1 && n <= 2) || n == 1, "d is too small to make a tree of n nodes");
+            std::vector<int> par(n, -1), slots(n, d - 1), free{0};
+            free.reserve(n);
+            slots[0] = d;
+            for(int i = 1; i < n; i++) {
+                const int j = rnd.next(static_cast<int>(free.size()));
+                par[i] = free[j];
+                if(--slots[free[j]] == 0) std::swap(free[j], free.back()), free.pop_back();
+                if(slots[i] > 0) free.push_back(i);
+            }
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a caterpillar: a spine path with legs (leaves) attached to it. <br>
+         * both ends of the spine get a leg, so the diameter is exactly spine_len + 1.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param spine_len the number of spine nodes
+         * @param leg_skew how legs are distributed along the spine, as the type of rnd.wnext. 0 means uniform.
+         * @return the generated tree
+         */
+        static BasicGraph caterpillar(const int n, const int spine_len, const int leg_skew = 0) {
+            chk(spine_len >= 1, "spine_len must be positive");
+            chk(n >= spine_len + 2, "n must be at least spine_len + 2");
+            std::vector<int> par(n, -1);
+            for(int i = 1; i < spine_len; i++) par[i] = i - 1;
+            par[spine_len] = 0, par[spine_len + 1] = spine_len - 1;
+            for(int i = spine_len + 2; i < n; i++) par[i] = rnd.wnext(spine_len, leg_skew);
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a broom: a handle path whose last node has all the other nodes as leaves. <br>
+         * the diameter is exactly the given value.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param diameter the diameter, which is also the number of handle nodes
+         * @return the generated tree
+         */
+        static BasicGraph broom(const int n, const int diameter) {
+            chk(diameter >= 1 && n >= diameter + 1, "n must be at least diameter + 1");
+            chk(diameter >= 2 || n == 2, "a broom with more than one bristle has diameter at least 2");
+            std::vector<int> par(n, -1);
+            for(int i = 1; i < diameter; i++) par[i] = i - 1;
+            for(int i = diameter; i < n; i++) par[i] = diameter - 1;
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a spider: a center with k paths (legs) of random lengths. <br>
+         * the leg lengths come from distribute_natural_numbers.
+         * if depth is positive, the longest leg has exactly that length.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param k the number of legs
+         * @param depth the length of the longest leg. 0 means no target.
+         * @return the generated tree
+         */
+        static BasicGraph spider(const int n, const int k, const int depth = 0) {
+            chk(1 <= k && k <= n - 1, "k must be in [1, n-1]");
+            std::vector<int> lens;
+            if(depth == 0) lens = distribute_natural_numbers(n - 1, k);
+            else {
+                const int rest = n - 1 - depth;
+                chk(depth >= 1 && rest >= k - 1 && rest <= 1LL * (k - 1) * depth, "cannot make the legs with the given depth");
+                if(k > 1) {
+                    lens = distribute_natural_numbers(rest, k - 1);
+                    // depth보다 긴 다리를 잘라서 남는 노드를 짧은 다리들에 나눠 줌
+                    int excess = 0;
+                    std::vector<int> below;
+                    for(int i = 0; i < k - 1; i++) {
+                        if(lens[i] > depth) excess += lens[i] - depth, lens[i] = depth;
+                        if(lens[i] < depth) below.push_back(i);
+                    }
+                    while(excess > 0) {
+                        const int j = rnd.next(static_cast<int>(below.size()));
+                        excess--;
+                        if(++lens[below[j]] == depth) std::swap(below[j], below.back()), below.pop_back();
+                    }
+                }
+                lens.insert(lens.begin() + rnd.next(k), depth);
+            }
+
+            std::vector<int> par(n, -1);
+            int cur = 1;
+            for(const int len : lens) {
+                par[cur] = 0;
+                for(int j = 1; j < len; j++) par[cur + j] = cur + j - 1;
+                cur += len;
+            }
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a lobster: a tree that becomes a caterpillar after removing its leaves. <br>
+         * both ends of the spine get a path of length 2, so the diameter is exactly spine_len + 3.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param spine_len the number of spine nodes
+         * @return the generated tree
+         */
+        static BasicGraph lobster(const int n, const int spine_len) {
+            chk(spine_len >= 1, "spine_len must be positive");
+            chk(n >= spine_len + 4, "n must be at least spine_len + 4");
+            std::vector<int> par(n, -1), middle;
+            middle.reserve(n);
+            for(int i = 1; i < spine_len; i++) par[i] = i - 1;
+            const int s = spine_len;
+            par[s] = 0, par[s + 1] = s, par[s + 2] = spine_len - 1, par[s + 3] = s + 2;
+            middle.push_back(s), middle.push_back(s + 2);
+            // 남은 노드는 척추에 붙는 중간 노드이거나, 중간 노드에 붙는 리프
+            for(int i = s + 4; i < n; i++) {
+                if(rnd.next(2)) par[i] = rnd.next(spine_len), middle.push_back(i);
+                else par[i] = rnd.any(middle);
+            }
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a random tree whose diameter is exactly d. <br>
+         * a path of d + 1 nodes is built first. every other node picks its parent uniformly among
+         * the nodes that can still take a child without making the diameter longer, so there is no rejection.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param d the diameter
+         * @return the generated tree
+         */
+        static BasicGraph tree_with_diameter(const int n, const int d) {
+            chk(0 <= d && d <= n - 1, "d must be in [0, n-1]");
+            chk(d >= 2 || n == d + 1, "a tree with more than d + 1 nodes has diameter at least 2");
+            // slack[u]: u 아래로 더 내려갈 수 있는 깊이
+            std::vector<int> par(n, -1), slack(n, 0), cand;
+            cand.reserve(n);
+            for(int i = 0; i <= d; i++) {
+                if(i > 0) par[i] = i - 1;
+                slack[i] = std::min(i, d - i);
+                if(slack[i] > 0) cand.push_back(i);
+            }
+            for(int i = d + 1; i < n; i++) {
+                par[i] = rnd.any(cand);
+                slack[i] = slack[par[i]] - 1;
+                if(slack[i] > 0) cand.push_back(i);
+            }
+            return from_parent_array(par, 0);
+        }
+
+        /**
+         * @brief generates a random rooted tree whose depth is exactly h. <br>
+         * a path of h + 1 nodes from the root is built first. every other node picks its parent uniformly
+         * among the nodes of depth less than h.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param h the depth (the largest distance from the root)
+         * @param root the number of the root node
+         * @return the generated tree
+         */
+        static BasicGraph tree_with_depth(const int n, const int h, const int root = 1) {
+            chk(0 <= h && h <= n - 1, "h must be in [0, n-1]");
+            chk(h >= 1 || n == 1, "a tree with more than one node has depth at least 1");
+            chk(1 <= root && root <= n, "root is not a valid node");
+            std::vector<int> par(n, -1), depth(n, 0), cand;
+            cand.reserve(n);
+            for(int i = 0; i <= h; i++) {
+                if(i > 0) par[i] = i - 1;
+                depth[i] = i;
+                if(i < h) cand.push_back(i);
+            }
+            for(int i = h + 1; i < n; i++) {
+                par[i] = rnd.any(cand);
+                depth[i] = depth[par[i]] + 1;
+                if(depth[i] < h) cand.push_back(i);
+            }
+            return from_parent_array(par, root);
+        }
+
+        /**
+         * @brief picks a uniformly random spanning tree of a connected base graph with Wilson's algorithm. <br>
+         * the base is treated as undirected. the returned edges keep their direction, weight and node numbers in base.
+         *
+         * Time complexity: O(V + E + the mean hitting time of base) expected
+         * @param base the connected base graph
+         * @return the spanning tree
+         */
+        static BasicGraph random_spanning_tree(const BasicGraph& base) {
+            return base.edge_subset(spanning_tree_edge_ids(base), true);
+        }
+
+        /**
+         * @brief generates a connected subgraph of base with m edges. <br>
+         * a uniform spanning tree of base is picked first, then m - (V-1) other edges of base are added.
+         *
+         * Time complexity: O(V + E + the mean hitting time of base) expected
+         * @param base the connected base graph
+         * @param m the edge count
+         * @return the generated graph
+         */
+        static BasicGraph connected_graph_over(const BasicGraph& base, const int m) {
+            const int n = base.V();
+            chk(n - 1 <= m && m <= base.E(), "edge count is out of range");
+            std::vector<int> ids = spanning_tree_edge_ids(base);
+            std::vector<bool> used(base.E(), false);
+            for(const int id : ids) used[id] = true;
+            std::vector<int> rest;
+            rest.reserve(base.E() - ids.size());
+            for(int id = 0; id < base.E(); id++) if(!used[id]) rest.push_back(id);
+            // 부분 Fisher-Yates로 남은 간선 중 필요한 만큼만 뽑음
+            const int extra = m - (n - 1);
+            for(int i = 0; i < extra; i++) {
+                std::swap(rest[i], rest[i + rnd.next(static_cast<int>(rest.size()) - i)]);
+                ids.push_back(rest[i]);
+            }
+            return base.edge_subset(ids, true).shuffle_edge_list();
+        }
+
+        /**
+         * @brief generates a connected graph with exactly the given number of bridges. <br>
+         * builds bridges + 1 blocks of at least three nodes, each a random ear decomposition
+         * with open and closed ears (so each block is 2-edge-connected), and joins the blocks with bridges in a random tree.
+         * with bridges = 0, the graph is 2-edge-connected.
+         * m is valid if it is in [n + bridges, bridges + the edges of K_{n-3*bridges} and bridges triangles].
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param bridges the number of bridges
+         * @return the generated graph
+         */
+        static BasicGraph two_edge_connected(const int n, const int m, const int bridges = 0) {
+            chk(bridges >= 0 && n >= 3LL * (bridges + 1), "n must be at least 3 * (bridges + 1)");
+            const int k = bridges + 1;
+            chk(1LL * n + bridges <= m && m <= bridges + max_block_edges(n, k), "edge count is out of range");
+            const std::vector<int> sizes = block_sizes(n, k, 1LL * m - bridges);
+            std::vector<long long> cnt = split_block_edges(sizes, 1LL * m - bridges - n);
+
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            std::vector<int> first(k + 1, 1);
+            for(int i = 0; i < k; i++) {
+                first[i + 1] = first[i] + sizes[i];
+                std::vector<int> label(sizes[i]);
+                for(int j = 0; j < sizes[i]; j++) label[j] = first[i] + j;
+                ear_decomposition(label, cnt[i], true, buf, index);
+                if(i > 0) {
+                    const int p = rnd.next(i);
+                    buf.emplace_back(first[p] + rnd.next(sizes[p]), first[i] + rnd.next(sizes[i]));
+                }
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf), true).nodes_shuffled();
+#ifndef NDEBUG
+            chk(ret.bridge_count() == bridges, "two_edge_connected produced a wrong number of bridges");
+#endif
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a connected graph with exactly the given number of cut vertices and no bridges. <br>
+         * builds cut_vertices + 1 blocks of at least three nodes, each a random ear decomposition with open ears
+         * (so each block is 2-vertex-connected). each block after the first shares one node,
+         * which is not yet a cut vertex, with an earlier block.
+         * with cut_vertices = 0, the graph is 2-vertex-connected.
+         * m is valid if it is in [n + cut_vertices, the edges of K_{n-2*cut_vertices} and cut_vertices triangles].
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param cut_vertices the number of cut vertices
+         * @return the generated graph
+         */
+        static BasicGraph biconnected(const int n, const int m, const int cut_vertices = 0) {
+            chk(cut_vertices >= 0 && n >= 3 + 2LL * cut_vertices, "n must be at least 3 + 2 * cut_vertices");
+            const int k = cut_vertices + 1;
+            // 블록들이 cut_vertices개의 노드를 공유하므로 블록 크기의 합은 n + cut_vertices
+            const long long min_m = 1LL * n + cut_vertices;
+            chk(min_m <= m && m <= max_block_edges(n + cut_vertices, k), "edge count is out of range");
+            const std::vector<int> sizes = block_sizes(n + cut_vertices, k, m);
+            std::vector<long long> cnt = split_block_edges(sizes, m - min_m);
+
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(m);
+            EdgeIndex index(m);
+            std::vector<int> not_cut;
+            not_cut.reserve(n);
+            int next_node = 1;
+            for(int i = 0; i < k; i++) {
+                std::vector<int> label(sizes[i]);
+                int j = 0;
+                if(i > 0) {
+                    const int x = rnd.next(static_cast<int>(not_cut.size()));
+                    label[j++] = not_cut[x];
+                    std::swap(not_cut[x], not_cut.back()), not_cut.pop_back();
+                }
+                for(; j < sizes[i]; j++) label[j] = next_node, not_cut.push_back(next_node++);
+                shuffle(label.begin(), label.end());
+                ear_decomposition(label, cnt[i], false, buf, index);
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf), true).nodes_shuffled();
+#ifndef NDEBUG
+            const auto [b, c] = ret.bridge_and_cut_vertex_count();
+            chk(b == 0 && c == cut_vertices, "biconnected produced a wrong number of cut vertices");
+#endif
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a random maximal planar graph (3n-6 edges) by stacked insertion. <br>
+         * each new node is put inside a uniformly random face and connected to its three corners.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @return the generated triangulation
+         */
+        static BasicGraph random_triangulation(const int n) {
+            BasicGraph ret = from_edge_buffer(n, stacked_triangulation_edges(n), true).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a random maximal outerplanar graph (2n-3 edges). <br>
+         * each new node is attached to both ends of a uniformly random edge of the outer cycle.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @return the generated graph
+         */
+        static BasicGraph random_outerplanar(const int n) {
+            chk(n >= 2, "a maximal outerplanar graph must have at least two nodes");
+            std::vector<std::pair<int, int>> buf{{1, 2}}, outer{{1, 2}, {2, 1}};
+            buf.reserve(2LL * n - 3), outer.reserve(n);
+            for(int x = 3; x <= n; x++) {
+                const int f = rnd.next(static_cast<int>(outer.size()));
+                const auto [a, b] = outer[f];
+                buf.emplace_back(a, x), buf.emplace_back(b, x);
+                outer[f] = {a, x}, outer.emplace_back(x, b);
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf), true).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a random planar graph with m edges, as a random edge subset of random_triangulation(n).
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param m the edge count, at most 3n-6
+         * @param connected if true, a spanning tree of the triangulation is always kept.
+         * @return the generated graph
+         */
+        static BasicGraph planar_graph(const int n, const int m, const bool connected = false) {
+            chk(n >= 3, "planar_graph must have at least three nodes");
+            chk((connected ? n - 1 : 0) <= m && m <= 3 * n - 6, "edge count is out of range");
+            std::vector<std::pair<int, int>> all = stacked_triangulation_edges(n), buf;
+            buf.reserve(m);
+            std::vector<int> rest;
+            rest.reserve(all.size());
+            for(int i = 0; i < static_cast<int>(all.size()); i++) {
+                if(connected && (i < 2 || (i >= 3 && i % 3 == 0))) buf.push_back(all[i]);
+                else rest.push_back(i);
+            }
+            for(int i = 0; static_cast<int>(buf.size()) < m; i++) {
+                std::swap(rest[i], rest[i + rnd.next(static_cast<int>(rest.size()) - i)]);
+                buf.push_back(all[rest[i]]);
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf), connected).nodes_shuffled();
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates an undirected grid that makes SPFA (queue-based Bellman-Ford) slow. <br>
+         * edges between rows get random weights in [1, max_w], and edges inside a row get small
+         * random weights in [1, perturb], so shortest paths keep being improved along the rows.
+         * the source is node 1 (a corner), and the cell (i, j) is node i * cols + j + 1.
+         *
+         * Time complexity: O(rows * cols)
+         * @param rows the number of rows. the slowdown grows with the number of rows (see bench.cpp).
+         * @param cols the number of columns
+         * @param max_w the maximum weight of the edges between rows
+         * @param perturb the maximum weight of the edges inside a row
+         * @return the generated graph
+         */
+        static BasicGraph<long long> anti_spfa_grid(const int rows, const int cols, const long long max_w, const long long perturb = 1) {
+            chk(1 <= perturb && perturb <= max_w, "perturb must be in [1, max_w]");
+            BasicGraph<long long> ret = BasicGraph<long long>::grid(rows, cols);
+            auto& w = ret.weights;
+            for(size_t i = 0; i < ret.edges.size(); i++) {
+                const auto [a, b] = ret.edges[i];
+                w[i] = b - a == 1 ? rnd.next(1LL, perturb) : rnd.next(1LL, max_w);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief generates a directed graph that makes Dijkstra without the visited (stale entry) check slow. <br>
+         * the source 1 starts a chain 2 -> 3 -> ... -> k+1 of unit edges, and each chain node has a shortcut
+         * to the hub k+2 whose weight decreases along the chain. the hub is improved k times before it is popped,
+         * and every stale copy of it scans all n-k-2 hub edges again, for O(k * (n-k)) work in total.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param k the chain length. 0 means (n - 2) / 2.
+         * @return the generated graph
+         */
+        static BasicGraph<long long> anti_dijkstra_chain(const int n, int k = 0) {
+            chk(n >= 4, "anti_dijkstra_chain must have at least four nodes");
+            if(k == 0) k = (n - 2) / 2;
+            chk(1 <= k && k <= n - 3, "k must be in [1, n-3]");
+            const int hub = k + 2;
+            BasicGraph<long long> ret(n);
+            ret.edges.reserve(2LL * k + n - k - 2), ret.weights.reserve(2LL * k + n - k - 2);
+            for(int i = 1; i <= k; i++) {
+                ret.add_edge(i, i + 1, 1);
+                // i+1번 노드의 거리는 i이므로, 허브까지의 거리 2k - i + 1은 체인을 따라 줄어듦
+                ret.add_edge(i + 1, hub, 2LL * (k - i) + 1);
+            }
+            for(int u = hub + 1; u <= n; u++) ret.add_edge(hub, u, 1);
+            return ret;
+        }
+
+        /**
+         * @brief generates a random function f: {1..n} -> {1..n} with exactly cycle_count cycles, as an array. <br>
+         * a random number of nodes (at least cycle_count) is split into cycles with distribute_natural_numbers,
+         * and the other nodes hang on them as in-trees.
+         *
+         * Time complexity: O(n)
+         * @param n the node count
+         * @param cycle_count the number of cycles
+         * @param tail_elongation the larger 'tail_elongation' makes the in-trees longer. can be negative.
+         * @return next, where next[u] = f(u). the value of next[0] is undefined.
+         */
+        static std::vector<int> functional_graph_next(const int n, const int cycle_count, const int tail_elongation = 0) {
+            chk(1 <= cycle_count && cycle_count <= n, "cycle_count must be in [1, n]");
+            std::vector<int> order(n), nxt(n + 1, 0);
+            for(int i = 0; i < n; i++) order[i] = i + 1;
+            shuffle(order.begin(), order.end());
+
+            // order의 앞 cyc개 노드로 사이클들을 만듦
+            const int cyc = rnd.next(cycle_count, n);
+            int cur = 0;
+            for(const int len : distribute_natural_numbers(cyc, cycle_count)) {
+                for(int j = 0; j < len; j++) nxt[order[cur + j]] = order[cur + (j + 1) % len];
+                cur += len;
+            }
+            for(int i = cyc; i < n; i++) nxt[order[i]] = order[rnd.wnext(i, tail_elongation)];
+            return nxt;
+        }
+
+        /**
+         * @brief generates a functional graph: the directed graph with the edges u -> f(u). <br>
+         * see functional_graph_next.
+         *
+         * Time complexity: approx. O(n)
+         * @param n the node count
+         * @param cycle_count the number of cycles
+         * @param tail_elongation the larger 'tail_elongation' makes the in-trees longer. can be negative.
+         * @return the generated graph
+         */
+        static BasicGraph functional_graph(const int n, const int cycle_count, const int tail_elongation = 0) {
+            const std::vector<int> nxt = functional_graph_next(n, cycle_count, tail_elongation);
+            std::vector<std::pair<int, int>> buf(n);
+            for(int u = 1; u <= n; u++) buf[u - 1] = {u, nxt[u]};
+            return from_edge_buffer(n, std::move(buf));
+        }
+
+        /**
+         * @brief generates a connected Eulerian graph with exactly m distinct edges. <br>
+         * undirected: every degree is even. directed: every in-degree equals the out-degree (so it is strongly connected). <br>
+         * starts from a random Hamiltonian cycle and repeatedly replaces an edge a - b with a - c - b.
+         * if m is more than half of the maximum, the edges of such a sparse Eulerian graph are removed
+         * from the densest Eulerian graph instead. if no move is left, the construction restarts. <br>
+         * m = maximum - 1 or maximum - 2 with an even undirected n is made from the perfect matching directly.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param directed whether the graph is directed
+         * @return the generated graph
+         */
+        static BasicGraph eulerian(const int n, const int m, const bool directed = false) {
+            chk(n >= (directed ? 2 : 3), "an Eulerian graph must have at least three nodes (two if directed)");
+            // 가장 조밀한 오일러 그래프: 완전 그래프 (n이 짝수이면 완전 그래프에서 완전 매칭을 뺀 그래프)
+            const long long max_m = directed ? 1LL * n * (n - 1) : (n % 2 ? 1LL * n * (n - 1) / 2 : 1LL * n * (n - 2) / 2);
+            chk(n <= m && m <= max_m, "edge count is out of range");
+            std::vector<int> perm(n);
+            for(int i = 0; i < n; i++) perm[i] = i + 1;
+
+            // 간선을 더 넣을 수 없는 상태에 빠지면 처음부터 다시 만듦
+            if(m <= max_m / 2) while(true) {
+                shuffle(perm.begin(), perm.end());
+                std::vector<std::pair<int, int>> buf;
+                buf.reserve(m);
+                EdgeIndex index(m);
+                for(int i = 0; i < n; i++) {
+                    buf.emplace_back(perm[i], perm[(i + 1) % n]);
+                    if(directed) index.insert(perm[i], perm[(i + 1) % n]);
+                    else index.insert_undir(perm[i], perm[(i + 1) % n]);
+                }
+                if(!grow_eulerian(n, m, directed, buf, index)) continue;
+                BasicGraph ret = from_edge_buffer(n, std::move(buf), true);
+                return directed ? ret.shuffle_edge_list() : ret.shuffle_edge_list_undir();
+            }
+
+            // 유향이면 max_m - 1, n이 홀수인 무향이면 max_m - 1과 max_m - 2개의 간선을 가진 오일러 그래프는 없음
+            const long long k = max_m - m;
+            chk(directed ? k != 1 : !(n % 2 && (k == 1 || k == 2)), "no Eulerian graph has this many edges");
+            while(true) {
+                shuffle(perm.begin(), perm.end());
+                // removed: 완전 그래프에서 뺄 간선
+                EdgeIndex removed(k + n);
+                if(!directed && n % 2 == 0 && (k == 1 || k == 2)) {
+                    // 완전 매칭에서 매칭 간선 a - b를 하나만 지나는 삼각형 a-b-c (k = 1) 또는 사이클 a-b-c-d (k = 2)를
+                    // 대칭차로 바꾸면 모든 차수가 홀수로 유지되고 간선이 k개 늘어남
+                    const int a = perm[0], b = perm[1], c = perm[2], d = perm[4];
+                    for(int i = 2; i < n; i += 2) removed.insert_undir(perm[i], perm[i + 1]);
+                    if(k == 1) removed.insert_undir(a, c), removed.insert_undir(b, c);
+                    else removed.insert_undir(b, c), removed.insert_undir(c, d), removed.insert_undir(d, a);
+                } else {
+                    // 완전 매칭 (n이 짝수인 무향) + 차수가 모두 짝수인 희소 그래프
+                    std::vector<std::pair<int, int>> sparse;
+                    sparse.reserve(k);
+                    if(!directed && n % 2 == 0) for(int i = 0; i < n; i += 2) removed.insert_undir(perm[i], perm[i + 1]);
+                    if(k > 0) {
+                        int a, b, c;
+                        if(directed) {
+                            a = rnd.next(n) + 1;
+                            do b = rnd.next(n) + 1; while(b == a);
+                            sparse = {{a, b}, {b, a}};
+                            removed.insert(a, b), removed.insert(b, a);
+                        } else {
+                            do {
+                                a = rnd.next(n) + 1, b = rnd.next(n) + 1, c = rnd.next(n) + 1;
+                            } while(a == b || b == c || a == c || removed.contains_undir(a, b) || removed.contains_undir(b, c) || removed.contains_undir(a, c));
+                            sparse = {{a, b}, {b, c}, {c, a}};
+                            removed.insert_undir(a, b), removed.insert_undir(b, c), removed.insert_undir(c, a);
+                        }
+                        if(!grow_eulerian(n, k, directed, sparse, removed)) continue;
+                    }
+                }
+
+                std::vector<std::pair<int, int>> buf;
+                buf.reserve(m);
+                for(int u = 1; u <= n; u++) for(int w = directed ? 1 : u + 1; w <= n; w++)
+                    if(u != w && !(directed ? removed.contains(u, w) : removed.contains_undir(u, w))) buf.emplace_back(u, w);
+                BasicGraph ret = from_edge_buffer(n, std::move(buf));
+                if(ret.connected_components().size() == 1U) return directed ? ret.shuffle_edge_list() : ret.shuffle_edge_list_undir();
+            }
+        }
+
+        /**
+         * @brief generates a connected graph with exactly m distinct edges that has an Eulerian path but no Eulerian circuit. <br>
+         * an edge a - b is removed from eulerian(n, m + 1, directed).
+         * undirected: a and b are the only odd nodes. directed: the path starts at b and ends at a. <br>
+         * if no Eulerian graph has m + 1 edges, a path of 2 or 3 edges is removed from the complete graph instead.
+         * for an even undirected n, m can be one more than the maximum of eulerian(): then a matching of n - 2 nodes
+         * (or of n - 4 nodes and a path of two edges) is removed from the complete graph.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param m the edge count
+         * @param directed whether the graph is directed
+         * @return the generated graph
+         */
+        static BasicGraph eulerian_path(const int n, const int m, const bool directed = false) {
+            chk(m < INT_MAX, "edge count is too large");
+            chk(n >= (directed ? 2 : 3), "an Eulerian graph must have at least three nodes (two if directed)");
+            const long long max_m = directed ? 1LL * n * (n - 1) : (n % 2 ? 1LL * n * (n - 1) / 2 : 1LL * n * (n - 2) / 2);
+            // n이 짝수인 무향 그래프는 완전 그래프의 모든 차수가 홀수이므로 오일러 회로의 최대보다 간선이 하나 더 많을 수 있음
+            const long long max_path_m = !directed && n % 2 == 0 ? max_m + 1 : max_m - 1;
+            chk(n - 1 <= m && m <= max_path_m, "edge count is out of range");
+            // 완전 그래프에서 removed의 간선을 뺀 그래프
+            auto complement = [&](const EdgeIndex& removed) {
+                std::vector<std::pair<int, int>> buf;
+                buf.reserve(m);
+                for(int u = 1; u <= n; u++) for(int w = directed ? 1 : u + 1; w <= n; w++)
+                    if(u != w && !(directed ? removed.contains(u, w) : removed.contains_undir(u, w))) buf.emplace_back(u, w);
+                BasicGraph ret = from_edge_buffer(n, std::move(buf), true);
+                return directed ? ret.shuffle_edge_list() : ret.shuffle_edge_list_undir();
+            };
+            if(!directed && n % 2 == 0 && m >= max_m) {
+                // n - 2개 노드의 매칭을 빼면 (m = max_m + 1), 또는 n - 4개 노드의 매칭과 경로 x-y-z를 빼면 (m = max_m)
+                // 차수가 짝수인 노드가 정확히 두 개 남음
+                std::vector<int> perm = rnd.perm(n, 1);
+                EdgeIndex removed(n);
+                const int matched = m > max_m ? n - 2 : n - 4;
+                for(int i = 0; i < matched; i += 2) removed.insert_undir(perm[i], perm[i + 1]);
+                if(m == max_m) removed.insert_undir(perm[n - 4], perm[n - 3]), removed.insert_undir(perm[n - 3], perm[n - 2]);
+                return complement(removed);
+            }
+            // 오일러 회로로 만들 수 없는 m + 1: 완전 그래프에서 길이 max_m - m인 경로를 빼면 그 양 끝만 차수가 맞지 않음
+            if(directed ? m + 2LL == max_m : n % 2 && (m + 2LL == max_m || m + 3LL == max_m)) {
+                std::vector<int> path = rnd.distinct(static_cast<int>(max_m - m) + 1, 1, n);
+                EdgeIndex removed(path.size());
+                for(size_t i = 0; i + 1 < path.size(); i++) {
+                    if(directed) removed.insert(path[i], path[i + 1]);
+                    else removed.insert_undir(path[i], path[i + 1]);
+                }
+                return complement(removed);
+            }
+            BasicGraph g = eulerian(n, m + 1, directed);
+            std::vector<std::pair<int, int>> buf = std::move(g.edges);
+            buf.pop_back();
+            return from_edge_buffer(n, std::move(buf), true);
+        }
+
+        /**
+         * @brief generates a random geometric graph: n uniform points in the unit square,
+         * and an edge between every two points at distance at most radius. <br>
+         * points are bucketed into a grid whose cells are at least radius wide, so only the neighbouring cells are compared.
+         *
+         * Time complexity: O(n + m) expected
+         * @param n the node count
+         * @param radius the connection radius
+         * @return the generated graph, and the coordinates of node i at index i (index 0 is unused)
+         */
+        static std::pair<BasicGraph, std::vector<std::pair<double, double>>> random_geometric(const int n, const double radius) {
+            chk(n >= 1, "n must be positive");
+            chk(radius >= 0.0, "radius must be non-negative");
+            std::vector<std::pair<double, double>> pos(n + 1);
+            for(int i = 1; i <= n; i++) pos[i] = {rnd.next(), rnd.next()};
+
+            // 한 변이 1 / g >= radius인 g x g 격자, 칸 수는 O(n)으로 제한
+            const int g = static_cast<int>(std::max(1.0, std::min(radius > 0.0 ? std::floor(1.0 / radius) : 1e9, std::floor(std::sqrt(static_cast<double>(n))))));
+            auto cell_of = [&](const int i) {
+                const int x = std::min(g - 1, static_cast<int>(pos[i].first * g));
+                const int y = std::min(g - 1, static_cast<int>(pos[i].second * g));
+                return x * g + y;
+            };
+            // 칸별 계수 정렬: 칸 c의 점은 order[start[c], start[c + 1])
+            std::vector<int> start(1LL * g * g + 1, 0), order(n);
+            for(int i = 1; i <= n; i++) start[cell_of(i) + 1]++;
+            for(int c = 0; c < g * g; c++) start[c + 1] += start[c];
+            std::vector<int> fill(start.begin(), start.end() - 1);
+            for(int i = 1; i <= n; i++) order[fill[cell_of(i)]++] = i;
+
+            const double r2 = radius * radius;
+            auto close = [&](const int a, const int b) {
+                const double dx = pos[a].first - pos[b].first, dy = pos[a].second - pos[b].second;
+                return dx * dx + dy * dy <= r2;
+            };
+            std::vector<std::pair<int, int>> buf;
+            // 같은 칸과 (0, 1), (1, -1), (1, 0), (1, 1) 방향의 이웃 칸만 보면 모든 쌍을 한 번씩 봄
+            const int dx[4] = {0, 1, 1, 1}, dy[4] = {1, -1, 0, 1};
+            for(int x = 0; x < g; x++) for(int y = 0; y < g; y++) {
+                const int c = x * g + y;
+                for(int p = start[c]; p < start[c + 1]; p++) {
+                    for(int q = p + 1; q < start[c + 1]; q++) if(close(order[p], order[q])) buf.emplace_back(order[p], order[q]);
+                    for(int d = 0; d < 4; d++) {
+                        const int nx = x + dx[d], ny = y + dy[d];
+                        if(nx >= g || ny < 0 || ny >= g) continue;
+                        const int nc = nx * g + ny;
+                        for(int q = start[nc]; q < start[nc + 1]; q++) if(close(order[p], order[q])) buf.emplace_back(order[p], order[q]);
+                    }
+                }
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf));
+            ret.shuffle_edge_list_undir();
+            return {std::move(ret), std::move(pos)};
+        }
+
+        /**
+         * @brief generates a Watts-Strogatz small-world graph. <br>
+         * each node of a ring is connected to its k nearest nodes, then each edge (u, v) is rewired with probability beta
+         * to (u, w) for a uniform w that is not u or a neighbour of u. the rewired edges are chosen by geometric skipping.
+         *
+         * Time complexity: O(n * k) expected
+         * @param n the node count
+         * @param k the degree of the ring lattice (even, less than n)
+         * @param beta the rewiring probability
+         * @return the generated graph
+         */
+        static BasicGraph small_world(const int n, const int k, const double beta) {
+            chk(n >= 1, "a graph must have at least one node");
+            chk(0 <= k && k < n && k % 2 == 0, "k must be an even number in [0, n)");
+            chk(0.0 <= beta && beta <= 1.0, "beta must be in [0, 1]");
+            chk(1LL * n * (k / 2) <= INT_MAX, "too many edges");
+            std::vector<int> label(n);
+            for(int i = 0; i < n; i++) label[i] = i + 1;
+            shuffle(label.begin(), label.end());
+
+            const int half = k / 2, m = n * half;
+            std::vector<std::pair<int, int>> buf(m);
+            std::vector<int> deg(n + 1, k);
+            EdgeIndex index(m);
+            for(int i = 0; i < n; i++) for(int j = 1; j <= half; j++) {
+                buf[i * half + j - 1] = {label[i], label[(i + j) % n]};
+                index.insert_undir(label[i], label[(i + j) % n]);
+            }
+
+            if(beta > 0.0) {
+                const double lb = std::log1p(-beta);
+                // 다음으로 다시 연결할 간선까지 건너뛸 간선의 개수 (기하분포)
+                auto skip = [&]() -> long long { return beta == 1.0 ? 0 : geometric_skip(lb, m); };
+                for(long long idx = skip(); idx < m; idx += 1 + skip()) {
+                    auto &[u, v] = buf[idx];
+                    if(deg[u] == n - 1) continue;
+                    int w;
+                    do w = rnd.next(n) + 1; while(w == u || index.contains_undir(u, w));
+                    index.erase_undir(u, v), index.insert_undir(u, w);
+                    deg[v]--, deg[w]++;
+                    v = w;
+                }
+            }
+            BasicGraph ret = from_edge_buffer(n, std::move(buf));
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a layered flow network: source -> layers x width nodes -> sink. <br>
+         * each node has out_degree edges to distinct nodes of the next layer, and every node has an in-edge and an out-edge.
+         * back_edges random edges go from a layer back to an earlier one. <br>
+         * if planted_flow > 0, one random stage of forward edges gets capacities summing to planted_flow
+         * and every other forward edge gets a capacity >= planted_flow, so the max flow is exactly planted_flow.
+         * otherwise every capacity is uniform in [1, max_cap]. <br>
+         * this is a random family (out_degree = width gives complete bipartite stages, width = 1 gives a long path);
+         * it is not the AK family. use augmenting_chain_network for an adversarial case.
+         *
+         * Time complexity: O(layers * width * out_degree + back_edges) expected
+         * @param layers the number of layers
+         * @param width the number of nodes in a layer
+         * @param out_degree the number of forward edges from a node of a layer to the next layer
+         * @param max_cap the maximum capacity
+         * @param planted_flow the max flow to plant. 0 means random capacities.
+         * @param back_edges the number of edges to earlier layers
+         * @tparam Cap the capacity type
+         * @return the network with random node numbers. max_flow is -1 if planted_flow is 0.
+         */
+        template <typename Cap = long long>
+        static FlowNetwork<Cap> layered_flow_network(const int layers, const int width, const int out_degree, const std::type_identity_t<Cap> max_cap,
+                                                     const std::type_identity_t<Cap> planted_flow = 0, const long long back_edges = 0) {
+            chk(layers >= 1 && width >= 1, "a layered network must have at least one layer and one node in a layer");
+            chk(1 <= out_degree && out_degree <= width, "out_degree must be in [1, width]");
+            chk(1LL * layers * width + 2 <= INT_MAX, "too many nodes");
+            chk(max_cap >= 1, "max_cap must be positive");
+            const long long stage_edges = 1LL * width * out_degree;
+            const long long back_pairs = 1LL * width * width * (1LL * layers * (layers - 1) / 2);
+            chk(0 <= back_edges && back_edges <= back_pairs, "too many back edges");
+            chk(2LL * width + (layers - 1) * stage_edges + back_edges <= INT_MAX, "too many edges");
+            chk(planted_flow == 0 || (std::max<long long>(width, layers >= 2 ? stage_edges : 0) <= planted_flow && planted_flow <= max_cap),
+                "planted_flow must be 0 or in [the number of edges of a stage, max_cap]");
+
+            const int n = layers * width + 2;
+            std::vector<int> label(n + 1);
+            for(int i = 1; i <= n; i++) label[i] = i;
+            shuffle(label.begin() + 1, label.end());
+            // L번째 층의 j번째 노드 (0-indexed), 소스는 label[1], 싱크는 label[n]
+            auto node = [&](const int L, const int j) { return label[2 + L * width + j]; };
+
+            std::vector<std::pair<int, int>> buf;
+            std::vector<int> stage;
+            buf.reserve(2LL * width + (layers - 1) * stage_edges + back_edges);
+            stage.reserve(buf.capacity());
+            for(int j = 0; j < width; j++) buf.emplace_back(label[1], node(0, j)), stage.push_back(0);
+            std::vector<int> match(width);
+            for(int j = 0; j < width; j++) match[j] = j;
+            for(int L = 0; L + 1 < layers; L++) {
+                // 무작위 완전 매칭으로 다음 층의 모든 노드에 들어오는 간선을 보장
+                shuffle(match.begin(), match.end());
+                for(int j = 0; j < width; j++) {
+                    buf.emplace_back(node(L, j), node(L + 1, match[j])), stage.push_back(L + 1);
+                    for(const long long t : sample_distinct(out_degree - 1, width - 1))
+                        buf.emplace_back(node(L, j), node(L + 1, static_cast<int>(t < match[j] ? t : t + 1))), stage.push_back(L + 1);
+                }
+            }
+            for(int j = 0; j < width; j++) buf.emplace_back(node(layers - 1, j), label[n]), stage.push_back(layers);
+            const size_t forward = buf.size();
+            // 뒤로 가는 간선: (층 쌍, 출발 위치, 도착 위치)를 하나의 번호로 뽑음
+            for(const long long idx : sample_distinct(back_edges, back_pairs)) {
+                const auto [a, b] = pair_from_index(idx / (1LL * width * width));
+                const long long r = idx % (1LL * width * width);
+                buf.emplace_back(node(b, static_cast<int>(r / width)), node(a, static_cast<int>(r % width))), stage.push_back(-1);
+            }
+
+            FlowNetwork<Cap> ret{BasicGraph<Cap>::from_edge_buffer(n, std::move(buf)), label[1], label[n], planted_flow > 0 ? planted_flow : Cap{-1}};
+            auto& cap = ret.graph.weights;
+            if(planted_flow == 0) {
+                for(auto& c : cap) c = rnd.next(Cap{1}, max_cap);
+            } else {
+                // 병목 단계의 용량 합은 planted_flow, 나머지 정방향 간선은 모두 planted_flow 이상
+                const int bottleneck = rnd.next(layers + 1);
+                std::vector<size_t> cut;
+                for(size_t i = 0; i < forward; i++) {
+                    if(stage[i] == bottleneck) cut.push_back(i);
+                    else cap[i] = rnd.next(planted_flow, max_cap);
+                }
+                std::vector<long long> bars = sample_distinct(static_cast<long long>(cut.size()) - 1, planted_flow - 1);
+                for(auto& x : bars) x++;
+                bars.push_back(0), bars.push_back(planted_flow);
+                std::sort(bars.begin(), bars.end());
+                for(size_t i = 0; i < cut.size(); i++) cap[cut[i]] = static_cast<Cap>(bars[i + 1] - bars[i]);
+                for(size_t i = forward; i < cap.size(); i++) cap[i] = rnd.next(Cap{1}, max_cap);
+            }
+            ret.graph.shuffle_edge_list();
+            return ret;
+        }
+
+        /**
+         * @brief generates a flow network where every augmenting path has a different length. <br>
+         * the source has a unit edge to every node of the chain c_1 -> c_2 -> ... -> c_k, and c_k goes to the sink.
+         * the path through c_i has length k - i + 2, so Dinic needs k phases and Edmonds-Karp needs k augmentations,
+         * each costing O(k). the max flow is k.
+         *
+         * Time complexity: O(k)
+         * @param k the chain length
+         * @tparam Cap the capacity type
+         * @return the network with random node numbers
+         */
+        template <typename Cap = long long> static FlowNetwork<Cap> augmenting_chain_network(const int k) {
+            chk(1 <= k && k <= INT_MAX / 2 - 1, "k must be in [1, INT_MAX / 2 - 1]");
+            const int n = k + 2;
+            std::vector<int> label(n + 1);
+            for(int i = 1; i <= n; i++) label[i] = i;
+            shuffle(label.begin() + 1, label.end());
+            // 소스는 label[1], 싱크는 label[n], c_i는 label[i + 1]
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(2LL * k);
+            for(int i = 1; i <= k; i++) buf.emplace_back(label[1], label[i + 1]);
+            for(int i = 1; i <= k; i++) buf.emplace_back(label[i + 1], i < k ? label[i + 2] : label[n]);
+            FlowNetwork<Cap> ret{BasicGraph<Cap>::from_edge_buffer(n, std::move(buf), true), label[1], label[n], k};
+            for(int i = 0; i < 2 * k; i++) ret.graph.weights[i] = i < k ? 1 : k;
+            ret.graph.shuffle_edge_list();
+            return ret;
+        }
+
+        /**
+         * @brief generates n random closed intervals [l, r]. <br>
+         * l is uniform in [1, n] and r - l is uniform in [0, 2 * avg_len], so a point is covered by about avg_len intervals.
+         *
+         * Time complexity: O(n)
+         * @param n the number of intervals
+         * @param avg_len the average length of the intervals
+         * @return intervals, where intervals[i] is the i-th interval (index 0 is unused)
+         */
+        static std::vector<std::pair<int, int>> random_intervals(const int n, const int avg_len) {
+            chk(n >= 1, "n must be positive");
+            chk(0 <= avg_len && 2LL * avg_len + n <= INT_MAX, "avg_len is out of range");
+            std::vector<std::pair<int, int>> ret(n + 1);
+            for(int i = 1; i <= n; i++) {
+                const int l = rnd.next(1, n);
+                ret[i] = {l, l + rnd.next(0, 2 * avg_len)};
+            }
+            return ret;
+        }
+
+        /**
+         * @brief streams the edges of the interval graph: i -- j if the closed intervals i and j intersect. <br>
+         * after sorting by the left endpoint, the intervals that intersect i and start after it are the
+         * contiguous run whose left endpoint is at most the right endpoint of i.
+         *
+         * Time complexity: O(n log n + m)
+         * @param intervals intervals[i] is the interval of node i (index 0 is unused)
+         * @param sink called as sink(i, j) once per edge
+         */
+        template <typename Sink> static void interval_graph_stream(const std::vector<std::pair<int, int>>& intervals, Sink&& sink) {
+            chk(!intervals.empty(), "intervals[0] must exist and is unused");
+            const int n = static_cast<int>(intervals.size()) - 1;
+            for(int i = 1; i <= n; i++) chk(intervals[i].first <= intervals[i].second, "an interval must satisfy l <= r");
+            std::vector<int> order(n);
+            for(int i = 0; i < n; i++) order[i] = i + 1;
+            std::sort(order.begin(), order.end(), [&](const int a, const int b) { return intervals[a].first < intervals[b].first; });
+            for(int p = 0; p < n; p++) {
+                const int i = order[p];
+                for(int q = p + 1; q < n && intervals[order[q]].first <= intervals[i].second; q++) sink(i, order[q]);
+            }
+        }
+
+        /**
+         * @brief generates the interval graph of the given intervals
+         *
+         * Time complexity: O(n log n + m)
+         * @param intervals intervals[i] is the interval of node i (index 0 is unused)
+         * @return the generated graph
+         */
+        static BasicGraph interval_graph(const std::vector<std::pair<int, int>>& intervals) {
+            std::vector<std::pair<int, int>> buf;
+            interval_graph_stream(intervals, [&](int a, int b) { buf.emplace_back(a, b); });
+            BasicGraph ret = from_edge_buffer(static_cast<int>(intervals.size()) - 1, std::move(buf));
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates the interval graph of random_intervals(n, avg_len)
+         *
+         * Time complexity: O(n log n + m)
+         * @param n the node count
+         * @param avg_len the average length of the intervals
+         * @return the generated graph, and the interval of node i at index i (index 0 is unused)
+         */
+        static std::pair<BasicGraph, std::vector<std::pair<int, int>>> random_interval_graph(const int n, const int avg_len) {
+            std::vector<std::pair<int, int>> intervals = random_intervals(n, avg_len);
+            BasicGraph g = interval_graph(intervals);
+            return {std::move(g), std::move(intervals)};
+        }
+
+        /**
+         * @brief generates a random chordal graph as the intersection graph of subtrees of a random tree. <br>
+         * each node gets a connected subtree of tree(n) with a uniform size in [1, max_subtree_size],
+         * grown from a random host node by adding random neighbours. two nodes are adjacent if their subtrees share a host node.
+         *
+         * Time complexity: O(n * max_subtree_size^2) expected
+         * @param n the node count
+         * @param max_subtree_size the maximum size of the subtrees. larger subtrees give denser graphs.
+         * @return the generated graph
+         */
+        static BasicGraph random_chordal(const int n, const int max_subtree_size = 4) {
+            chk(n >= 1, "n must be positive");
+            chk(1 <= max_subtree_size && max_subtree_size <= n, "max_subtree_size must be in [1, n]");
+            const std::vector<std::vector<int>> adj = tree(n).adjacency_list_undir();
+            // owners[x]: 호스트 노드 x를 부분 트리에 포함하는 노드들
+            std::vector<std::vector<int>> owners(n + 1);
+            std::vector<int> mark(n + 1, 0), frontier;
+            for(int u = 1; u <= n; u++) {
+                const int size = rnd.next(1, max_subtree_size);
+                frontier.assign(1, rnd.next(1, n));
+                mark[frontier[0]] = u;
+                for(int taken = 0; taken < size && !frontier.empty(); taken++) {
+                    const int j = rnd.next(static_cast<int>(frontier.size()));
+                    const int x = frontier[j];
+                    frontier[j] = frontier.back(), frontier.pop_back();
+                    owners[x].push_back(u);
+                    for(const int y : adj[x]) if(mark[y] != u) mark[y] = u, frontier.push_back(y);
+                }
+            }
+
+            std::vector<std::pair<int, int>> buf;
+            EdgeIndex index(1LL * n * max_subtree_size);
+            for(int x = 1; x <= n; x++) for(size_t i = 0; i < owners[x].size(); i++) for(size_t j = i + 1; j < owners[x].size(); j++)
+                if(index.insert_undir(owners[x][i], owners[x][j])) buf.emplace_back(owners[x][i], owners[x][j]);
+            BasicGraph ret = from_edge_buffer(n, std::move(buf));
+            return ret.shuffle_edge_list_undir();
+        }
+
+        /**
+         * @brief generates a uniformly random tournament as a bit matrix. <br>
+         * the upper triangle is filled with random words, and the lower triangle is the complement of its
+         * transpose, done in 64 x 64 blocks.
+         *
+         * Time complexity: O(n^2 / 64)
+         * @param n the node count
+         * @return the generated tournament
+         */
+        static TournamentMatrix tournament_matrix(const int n) {
+            chk(n >= 1, "a tournament must have at least one node");
+            TournamentMatrix ret(n);
+            const size_t words = ret.words;
+            auto random_word = []() { return static_cast<unsigned long long>(rnd.next(1LL << 32)) << 32 | static_cast<unsigned long long>(rnd.next(1LL << 32)); };
+            // 위 삼각형: 행 u에서 열이 u보다 큰 비트만 무작위로 채움
+            for(int u = 1; u <= n; u++) for(size_t w = (u - 1) >> 6; w < words; w++) {
+                unsigned long long x = random_word();
+                if(w == static_cast<size_t>((u - 1) >> 6)) x &= ~((2ULL << ((u - 1) & 63)) - 1);
+                if(w + 1 == words && n % 64) x &= (1ULL << (n % 64)) - 1;
+                ret.word(u, w) = x;
+            }
+            // 아래 삼각형: 블록 (I, J)를 전치하고 뒤집어 블록 (J, I)에 씀
+            unsigned long long block[64];
+            for(size_t I = 0; I < words; I++) for(size_t J = I; J < words; J++) {
+                for(int r = 0; r < 64; r++) {
+                    const int u = static_cast<int>(I * 64) + r + 1;
+                    block[r] = u <= n ? ret.word(u, J) : 0;
+                }
+                transpose64(block);
+                for(int c = 0; c < 64; c++) {
+                    const int v = static_cast<int>(J * 64) + c + 1;
+                    if(v > n) break;
+                    // v보다 작은 열만 v의 행에 씀
+                    const int lim = std::min(64, std::min(n - static_cast<int>(I * 64), v - 1 - static_cast<int>(I * 64)));
+                    if(lim <= 0) continue;
+                    const unsigned long long mask = lim == 64 ? ~0ULL : (1ULL << lim) - 1;
+                    ret.word(v, I) |= ~block[c] & mask;
+                }
+            }
+            return ret;
+        }
+
+        /**
+         * @brief generates a transitive tournament on a random order of the nodes, then reverses flips distinct random edges. <br>
+         * flips = 0 has no 3-cycles, and more flips give more 3-cycles (see TournamentMatrix::three_cycle_count).
+         *
+         * Time complexity: O(n^2 / 64 + flips) expected
+         * @param n the node count
+         * @param flips the number of reversed edges
+         * @return the generated tournament
+         */
+        static TournamentMatrix transitive_tournament_matrix(const int n, const long long flips) {
+            chk(n >= 1, "a tournament must have at least one node");
+            chk(0 <= flips && flips <= 1LL * n * (n - 1) / 2, "flips must be in [0, n(n-1)/2]");
+            TournamentMatrix ret(n);
+            std::vector<int> order(n);
+            for(int i = 0; i < n; i++) order[i] = i + 1;
+            shuffle(order.begin(), order.end());
+            // 순서대로 자신을 지운 나머지가 자신이 이기는 노드들
+            std::vector<unsigned long long> rest(ret.words, ~0ULL);
+            if(n % 64) rest.back() = (1ULL << (n % 64)) - 1;
+            for(const int u : order) {
+                rest[(u - 1) >> 6] ^= 1ULL << ((u - 1) & 63);
+                std::copy(rest.begin(), rest.end(), ret.bits.begin() + static_cast<long long>((u - 1) * ret.words));
+            }
+            for(const long long idx : sample_distinct(flips, 1LL * n * (n - 1) / 2)) {
+                const auto [a, b] = pair_from_index(idx);
+                ret.flip(a + 1, b + 1);
+            }
+            return ret;
+        }
+
+        /**
+         * @brief makes the directed graph of a tournament matrix
+         *
+         * Time complexity: O(n^2)
+         * @param t the tournament
+         * @return the graph with the edge u -> v for every u that beats v
+         */
+        static BasicGraph tournament(const TournamentMatrix& t) {
+            const int n = t.size();
+            std::vector<std::pair<int, int>> buf;
+            buf.reserve(1LL * n * (n - 1) / 2);
+            for(int u = 1; u <= n; u++) for(size_t w = 0; w < t.words; w++)
+                for(unsigned long long x = t.word(u, w); x; x &= x - 1) buf.emplace_back(u, static_cast<int>(w * 64 + std::countr_zero(x)) + 1);
+            BasicGraph ret = from_edge_buffer(n, std::move(buf), true);
+            return ret.shuffle_edge_list();
+        }
+
+        /**
+         * @brief generates a uniformly random tournament
+         *
+         * Time complexity: O(n^2)
+         * @param n the node count
+         * @return the generated graph
+         */
+        static BasicGraph tournament(const int n) { return tournament(tournament_matrix(n)); }
+
+        /**
+         * @brief the disjoint union of a and b: the node i of b becomes a.V + i. <br>
+         * the edges (and weights) of b are appended with the offset, and the DSU of b is copied with the offset
+         * instead of merging its edges again.
+         *
+         * Time complexity: O(V + E)
+         * @param a the first graph
+         * @param b the second graph
+         * @return the union
+         */
+        static BasicGraph disjoint_union(const BasicGraph& a, const BasicGraph& b) {
+            chk(static_cast<long long>(a.v) + b.v <= INT_MAX, "too many nodes");
+            const int off = a.v;
+            BasicGraph ret;
+            ret.v = a.v + b.v;
+            ret.edges.reserve(a.edges.size() + b.edges.size());
+            ret.edges.insert(ret.edges.end(), a.edges.begin(), a.edges.end());
+            for(const auto& [x, y] : b.edges) ret.edges.emplace_back(x + off, y + off);
+            if constexpr(weighted) {
+                ret.weights.reserve(ret.edges.size());
+                ret.weights.insert(ret.weights.end(), a.weights.begin(), a.weights.end());
+                ret.weights.insert(ret.weights.end(), b.weights.begin(), b.weights.end());
+            }
+            ret.group = a.group, ret.rank = a.rank;
+            ret.group.resize(ret.v + 1), ret.rank.resize(ret.v + 1);
+            for(int i = 1; i <= b.v; i++) ret.group[i + off] = b.group[i] + off, ret.rank[i + off] = b.rank[i];
+            return ret;
+        }
+
+        /**
+         * @brief the join of a and b: their disjoint union plus an edge from every node of a to every node of b
+         *
+         * Time complexity: O(V + E + a.V * b.V)
+         * @param a the first graph
+         * @param b the second graph
+         * @return the join. the new edges have the weight weight_type{}.
+         */
+        static BasicGraph join(const BasicGraph& a, const BasicGraph& b) {
+            chk(a.v >= 1 && b.v >= 1, "both graphs must have at least one node");
+            chk(a.edges.size() + b.edges.size() + 1ULL * a.v * b.v <= INT_MAX, "too many edges");
+            BasicGraph ret = disjoint_union(a, b);
+            ret.edges.reserve(ret.edges.size() + 1ULL * a.v * b.v);
+            for(int x = 1; x <= a.v; x++) for(int y = 1; y <= b.v; y++) ret.edges.emplace_back(x, a.v + y);
+            if constexpr(weighted) ret.weights.resize(ret.edges.size());
+            // 모든 노드가 연결됨
+            for(int i = 1; i <= ret.v; i++) ret.group[i] = 1, ret.rank[i] = 0;
+            if(ret.v > 1) ret.rank[1] = 1;
+            return ret;
+        }
+
+        /**
+         * @brief the disjoint union of a and b plus one bridge between the node u of a and the node w of b
+         *
+         * Time complexity: O(V + E)
+         * @param a the first graph
+         * @param b the second graph
+         * @param u a node of a. 0 means a random node.
+         * @param w a node of b. 0 means a random node.
+         * @return the result. the bridge is the last edge and has the weight weight_type{}.
+         */
+        static BasicGraph attach_by_bridge(const BasicGraph& a, const BasicGraph& b, int u = 0, int w = 0) {
+            chk(a.v >= 1 && b.v >= 1, "both graphs must have at least one node");
+            chk(0 <= u && u <= a.v && 0 <= w && w <= b.v, "not a valid node");
+            if(u == 0) u = rnd.next(1, a.v);
+            if(w == 0) w = rnd.next(1, b.v);
+            BasicGraph ret = disjoint_union(a, b);
+            ret.add_edge(u, a.v + w);
+            return ret;
+        }
+
+        /**
+         * @brief the cartesian product of a and b: the node (i, j) is (i - 1) * b.V + j. <br>
+         * (x, j) -- (y, j) for every edge x -- y of a, and (i, p) -- (i, q) for every edge p -- q of b, with the same weights.
+         * the components are the products of the components, so the DSU is filled directly.
+         *
+         * Time complexity: O(a.V * b.E + a.E * b.V)
+         * @param a the first graph
+         * @param b the second graph
+         * @return the product
+         */
+        static BasicGraph cartesian_product(const BasicGraph& a, const BasicGraph& b) {
+            chk(1LL * a.v * b.v <= INT_MAX, "too many nodes");
+            chk(1LL * a.edges.size() * b.v + 1LL * b.edges.size() * a.v <= INT_MAX, "too many edges");
+            const int bv = b.v;
+            auto id = [&](const int i, const int j) { return (i - 1) * bv + j; };
+            BasicGraph ret(a.v * b.v);
+            ret.edges.reserve(a.edges.size() * b.v + b.edges.size() * a.v);
+            if constexpr(weighted) ret.weights.reserve(ret.edges.capacity());
+            for(size_t e = 0; e < a.edges.size(); e++) for(int j = 1; j <= bv; j++) {
+                ret.edges.emplace_back(id(a.edges[e].first, j), id(a.edges[e].second, j));
+                if constexpr(weighted) ret.weights.push_back(a.weights[e]);
+            }
+            for(int i = 1; i <= a.v; i++) for(size_t e = 0; e < b.edges.size(); e++) {
+                ret.edges.emplace_back(id(i, b.edges[e].first), id(i, b.edges[e].second));
+                if constexpr(weighted) ret.weights.push_back(b.weights[e]);
+            }
+            // (i, j)의 대표 = (i의 대표, j의 대표)
+            auto root = [](const BasicGraph& g, int x) { while(g.group[x] != x) x = g.group[x]; return x; };
+            std::vector<int> rb(bv + 1);
+            for(int j = 1; j <= bv; j++) rb[j] = root(b, j);
+            for(int i = 1; i <= a.v; i++) {
+                const int ra = root(a, i);
+                for(int j = 1; j <= bv; j++) ret.group[id(i, j)] = id(ra, rb[j]);
+            }
+            for(int x = 1; x <= ret.v; x++) if(ret.group[x] == x) ret.rank[x] = 1;
+            return ret;
+        }
+
+        /**
+         * @brief replaces every edge a -- b with a path a -- c_1 -- ... -- c_k -- b through k new nodes. <br>
+         * the new nodes of the i-th edge are g.V + i * k + 1, ..., g.V + i * k + k, and every piece keeps the weight of its edge.
+         *
+         * Time complexity: O(V + k * E)
+         * @param g the graph
+         * @param k the number of new nodes on each edge
+         * @return the subdivided graph
+         */
+        static BasicGraph subdivide_edges(const BasicGraph& g, const int k = 1) {
+            chk(k >= 0, "k must be non-negative");
+            chk(g.v + 1LL * k * g.edges.size() <= INT_MAX, "too many nodes");
+            const int n = g.v + k * static_cast<int>(g.edges.size());
+            BasicGraph ret;
+            ret.v = n;
+            ret.edges.reserve((k + 1) * g.edges.size());
+            if constexpr(weighted) ret.weights.reserve(ret.edges.capacity());
+            ret.group = g.group, ret.rank = g.rank;
+            ret.group.resize(n + 1), ret.rank.resize(n + 1, 0);
+            for(size_t e = 0; e < g.edges.size(); e++) {
+                int prev = g.edges[e].first;
+                const int base = g.v + static_cast<int>(e) * k;
+                for(int t = 1; t <= k + 1; t++) {
+                    const int cur = t <= k ? base + t : g.edges[e].second;
+                    ret.edges.emplace_back(prev, cur);
+                    if constexpr(weighted) ret.weights.push_back(g.weights[e]);
+                    prev = cur;
+                }
+                // 새 노드는 간선의 시작 노드와 같은 그룹
+                for(int t = 1; t <= k; t++) ret.group[base + t] = g.edges[e].first;
+            }
+            return ret;
+        }
+
+        /// 일자 그래프를 생성
+        /// 1--2 2--3 3--4 ... (n-1)--n 형태의 그래프를 의미
+        /// first_node와 last_node를 설정하면 차수가 1인 노드가 각각 first_node와 last_node인 그래프를 반환
+        static BasicGraph path_graph(const int n, const int first_node = -1, const int last_node = -1) {
+            std::vector<int> arr(n);
+            for(int i = 0; i < n; i++) arr[i] = i+1;
+            shuffle(arr.begin(), arr.end());
+
+            if(first_node != -1) {
+                chk(1 <= first_node && first_node <= n, "first_node is not a valid node");
+                chk(first_node != last_node && n > 1, "first_node and last_node cannot be the same");
+                for(int i = 0; i < n; i++) if(arr[i] == first_node) std::swap(arr[0], arr[i]);
+            }
+
+            if(last_node != -1) {
+                chk(1 <= last_node && last_node <= n, "last_node is not a valid node");
+                for(int i = 0; i < n; i++) if(arr[i] == last_node) std::swap(arr[n-1], arr[i]);
+            }
+
+            if(first_node != -1) assert(arr[0] == first_node);
+            if(last_node != -1) assert(arr[n-1] == last_node);
+
+            BasicGraph ret(n);
+            for(int i = 0; i < n-1; i++) ret.add_edge(arr[i], arr[i+1]);
+            return ret;
+        }
+
+        /**
+         * @brief generates a complete graph of n nodes
+         *
+         * Time complexity: O(n^2 log n)
+         * @param n node count
+         * @return the complete graph
+         */
+        static BasicGraph complete_graph(const int n) {
+            BasicGraph ret(n);
+            for(int i = 1; i <= n; i++) for(int j = i+1; j <= n; j++) ret.add_edge(i, j);
+            return ret;
+        }
+
+        /**
+         * @brief generates a star graph of n nodes
+         *
+         * Time complexity: O(n log n)
+         * @param n node count
+         * @param root the node to which all other nodes are connected
+         * @return the complete graph
+         */
+        static BasicGraph star_graph(const int n, const int root = 1) {
+            BasicGraph ret(n);
+            for(int i = 1; i <= n; i++) if(i != root) ret.add_edge(root, i);
+            return ret;
+        }
+
+        // path graph에서 리프 노드가 아닌 모든 노드에 리프 노드 하나를 이은 그래프
+        static BasicGraph skeleton_tree(const int n) {
+            chk(n % 2 == 0, "node count must be even at skeleton graph");
+            int line_len = n / 2 + 1;
+            BasicGraph g(n);
+            for(int i = 2; i <= line_len; i++) g.add_edge(i - 1, i);
+            for(int i = 2; i <= line_len - 1; i++) g.add_edge(i, line_len + i - 1);
+            return g;
+        }
+
+        // 노드개수 간선개수
         // u1 v1
         // u2 v2
         // ...
+        // weighted이면 각 줄 끝에 가중치를 붙여 출력
         void ps_style_print(const bool zero_base = false) const {
             println(v, edges.size());
-            for(auto& [u, u2] : edges) println(u - zero_base, u2 - zero_base);
+            for(size_t i = 0; i < edges.size(); i++) {
+                const auto& [u, u2] = edges[i];
+                if constexpr(weighted) println(u - zero_base, u2 - zero_base, weights[i]);
+                else println(u - zero_base, u2 - zero_base);
+            }
         }
 
         void csacademy_style_print() const {
             for(int i = 1; i <= v; i++) println(i);
-            for(const auto& [u, u2] : edges) println(u, u2);
+            print_edges();
         }
 
         void print_edges() const {
-            for(const auto& [u, u2] : edges) println(u, u2);
+            for(size_t i = 0; i < edges.size(); i++) {
+                const auto& [u, u2] = edges[i];
+                if constexpr(weighted) println(u, u2, weights[i]);
+                else println(u, u2);
+            }
         }
     };
 
+    using Graph = BasicGraph<>;
+
+    /**
+     * @brief a directed graph whose edge weights are capacities, with its source and sink
+     */
+    template <typename Cap> struct FlowNetwork {
+        BasicGraph<Cap> graph;
+        int source = 0, sink = 0;
+        // 알려진 최대 유량, 모르면 -1
+        Cap max_flow = -1;
+    };
+
 #undef chk
 }
 
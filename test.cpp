@@ -0,0 +1,164 @@
+#include "graphGen.h"
+
+using namespace graphGen;
+using namespace std;
+
+// 작은 입력에서 생성기들이 멈추지 않고 조건을 만족하는지 확인. 실패하면 0이 아닌 값으로 종료
+
+int failures = 0;
+
+void expect(const bool b, const string& what) {
+    if(!b) cerr << "FAILED: " << what << '\n', failures++;
+}
+
+bool simple(const Graph& g) {
+    set<pair<int, int>> seen;
+    for(auto [a, b] : g.edge_list()) {
+        if(a == b || !seen.insert({min(a, b), max(a, b)}).second) return false;
+    }
+    return true;
+}
+
+void test_random_regular() {
+    for(int n = 1; n <= 12; n++) for(int d = 0; d < n; d++) {
+        if(n * d % 2) continue;
+        for(int seed = 1; seed <= 300; seed++) {
+            rnd.setSeed(seed);
+            const Graph g = Graph::random_regular(n, d);
+            vector<int> deg(n + 1);
+            for(auto [a, b] : g.edge_list()) deg[a]++, deg[b]++;
+            const string name = "random_regular(" + to_string(n) + ", " + to_string(d) + ") seed " + to_string(seed);
+            expect(simple(g), name + " is simple");
+            expect(count(deg.begin() + 1, deg.end(), d) == n, name + " is regular");
+        }
+    }
+}
+
+// 간선 수, 중복, 연결성을 확인하고, 차수 조건을 어기는 노드 수를 반환
+int eulerian_defects(const Graph& g, const int m, const bool directed, const string& name) {
+    const int n = g.V();
+    expect(static_cast<int>(g.edge_list().size()) == m, name + " has m edges");
+    set<pair<int, int>> seen;
+    vector<int> in(n + 1), out(n + 1);
+    for(auto [a, b] : g.edge_list()) {
+        expect(a != b && seen.insert(directed ? make_pair(a, b) : make_pair(min(a, b), max(a, b))).second, name + " is simple");
+        out[a]++, in[b]++;
+    }
+    Graph h = g;
+    expect(h.connected_components().size() == 1U, name + " is connected");
+    int defects = 0;
+    for(int v = 1; v <= n; v++) defects += directed ? in[v] != out[v] : (in[v] + out[v]) % 2;
+    return defects;
+}
+
+void test_eulerian() {
+    for(int directed = 0; directed < 2; directed++) for(int n = directed ? 2 : 3; n <= 8; n++) {
+        const int max_m = directed ? n * (n - 1) : (n % 2 ? n * (n - 1) / 2 : n * (n - 2) / 2);
+        // 오일러 경로 그래프의 최대 간선 수: n이 짝수인 무향이면 max_m + 1, 아니면 max_m - 1
+        const int max_path_m = !directed && n % 2 == 0 ? max_m + 1 : max_m - 1;
+        for(int m = n - 1; m <= max(max_m, max_path_m); m++) for(int seed = 1; seed <= 50; seed++) {
+            const string args = "(" + to_string(n) + ", " + to_string(m) + ", " + to_string(directed) + ") seed " + to_string(seed);
+            const int k = max_m - m;
+            if(m >= n && m <= max_m && (directed ? k != 1 : !(n % 2 && (k == 1 || k == 2)))) {
+                rnd.setSeed(seed);
+                expect(eulerian_defects(Graph::eulerian(n, m, directed), m, directed, "eulerian" + args) == 0, "eulerian" + args + " has a circuit");
+            }
+            if(m <= max_path_m) {
+                rnd.setSeed(seed);
+                expect(eulerian_defects(Graph::eulerian_path(n, m, directed), m, directed, "eulerian_path" + args) == 2, "eulerian_path" + args + " has a path");
+            }
+        }
+    }
+}
+
+int scc_count(const Graph& g) {
+    const int n = g.V();
+    vector<vector<bool>> reach(n + 1, vector<bool>(n + 1, false));
+    for(int v = 1; v <= n; v++) reach[v][v] = true;
+    for(auto [a, b] : g.edge_list()) reach[a][b] = true;
+    for(int w = 1; w <= n; w++) for(int u = 1; u <= n; u++) for(int v = 1; v <= n; v++)
+        if(reach[u][w] && reach[w][v]) reach[u][v] = true;
+    int ret = 0;
+    for(int v = 1; v <= n; v++) {
+        bool leader = true;
+        for(int u = 1; u < v; u++) if(reach[u][v] && reach[v][u]) leader = false;
+        ret += leader;
+    }
+    return ret;
+}
+
+void test_planted_scc() {
+    for(int n = 1; n <= 7; n++) for(int k = 1; k <= n; k++) {
+        const int big = n - k + 1;
+        const int min_m = big >= 2 ? big : 0, max_m = n * (n - 1) / 2 + big * (big - 1) / 2;
+        for(int m = min_m; m <= max_m; m++) for(int seed = 1; seed <= 40; seed++) {
+            rnd.setSeed(seed);
+            const Graph g = Graph::planted_scc(n, m, k);
+            const string name = "planted_scc(" + to_string(n) + ", " + to_string(m) + ", " + to_string(k) + ") seed " + to_string(seed);
+            expect(static_cast<int>(g.edge_list().size()) == m, name + " has m edges");
+            set<pair<int, int>> seen;
+            for(auto e : g.edge_list()) expect(e.first != e.second && seen.insert(e).second, name + " is simple");
+            expect(scc_count(g) == k, name + " has k components");
+        }
+    }
+}
+
+void test_blocks() {
+    for(int n = 3; n <= 10; n++) {
+        for(int bridges = 0; 3 * (bridges + 1) <= n; bridges++) {
+            const int big = n - 3 * bridges;
+            for(int m = n + bridges; m <= bridges + big * (big - 1) / 2 + 3 * bridges; m++) for(int seed = 1; seed <= 40; seed++) {
+                rnd.setSeed(seed);
+                Graph g = Graph::two_edge_connected(n, m, bridges);
+                const string name = "two_edge_connected(" + to_string(n) + ", " + to_string(m) + ", " + to_string(bridges) + ") seed " + to_string(seed);
+                expect(static_cast<int>(g.edge_list().size()) == m && simple(g), name + " has m distinct edges");
+                expect(g.connected_components().size() == 1U && g.bridge_count() == bridges, name + " has the bridges");
+            }
+        }
+        for(int cut = 0; 3 + 2 * cut <= n; cut++) {
+            const int big = n - 2 * cut;
+            for(int m = n + cut; m <= big * (big - 1) / 2 + 3 * cut; m++) for(int seed = 1; seed <= 40; seed++) {
+                rnd.setSeed(seed);
+                Graph g = Graph::biconnected(n, m, cut);
+                const string name = "biconnected(" + to_string(n) + ", " + to_string(m) + ", " + to_string(cut) + ") seed " + to_string(seed);
+                expect(static_cast<int>(g.edge_list().size()) == m && simple(g), name + " has m distinct edges");
+                expect(g.connected_components().size() == 1U && g.bridge_and_cut_vertex_count() == make_pair(0, cut), name + " has the cut vertices");
+            }
+        }
+    }
+}
+
+// 1 - p가 1로 반올림되는 아주 작은 확률
+void test_tiny_probabilities() {
+    for(int directed = 0; directed < 2; directed++) for(const double p : {1e-17, 1e-300}) {
+        long long cnt = 0;
+        Graph::gnp_stream(1000, p, [&](int, int) { cnt++; }, directed);
+        expect(cnt == 0, "gnp_stream(1000, " + to_string(p) + ", " + to_string(directed) + ") has no edges");
+    }
+    for(const double beta : {1e-17, 1e-300}) {
+        const Graph g = Graph::small_world(1000, 4, beta);
+        vector<int> deg(1001);
+        for(auto [a, b] : g.edge_list()) deg[a]++, deg[b]++;
+        expect(count(deg.begin() + 1, deg.end(), 4) == 1000, "small_world(1000, 4, " + to_string(beta) + ") is not rewired");
+    }
+}
+
+void test_rmat() {
+    // a + d = 0이면 모든 간선이 대각선 밖의 두 사분면으로 감
+    const Graph g = Graph::rmat(4, 4, 0, .5, .5, 0, false);
+    expect(g.edge_list().size() == 64U, "rmat(4, 4, 0, .5, .5) has 64 edges");
+    for(auto [u, w] : g.edge_list()) expect(u != w, "rmat(4, 4, 0, .5, .5) has no self-loop");
+}
+
+int main(int argc, char** argv) {
+    registerGen(argc, argv, 1);
+    test_random_regular();
+    test_eulerian();
+    test_planted_scc();
+    test_blocks();
+    test_tiny_probabilities();
+    test_rmat();
+    if(failures) cerr << failures << " check(s) failed\n";
+    else cerr << "all checks passed\n";
+    return failures ? 1 : 0;
+}